@@ -1,8 +1,86 @@
-zcc +zx -vn -startup=31 -DWFRAMES=3 -clib=sdcc_iy -SO3 --max-allocs-per-node10000 --fsigned-char @zproject.lst -o munchkin -pragma-include:zpragma.inc
+zcc +zx -vn -startup=31 -DWFRAMES=1 -clib=sdcc_iy -SO3 --max-allocs-per-node10000 --fsigned-char @zproject.lst -o munchkin -m -pragma-include:zpragma.inc
 
 z88dk.z88dk-appmake +zx -b munchkin_CODE.bin -o game.tap --blockname game --org 25124 --noloader
 
 cat loader.tap screen.tap  game.tap > munchkin_z80.tap
 
+# memory budget (code, rodata, bss, stack, im2, sp1 and what is left)
+python tools/memmap.py munchkin.map
+
+# the png converters (tools/png2c.py, png2scr.py and png2sprite.py) need Pillow: pip install pillow
+
+# after editing the sprites, share and overlap their frames (drop --write to only report):
+# python tools/spritepack.py --write gfx/munchkin.asm gfx/ghost.asm gfx/pill.asm
+
+# host checks (gcc and python, no z88dk): main.c built for the PC with tools/host/ in place of the libraries
+# the assembly movement kernels (src/move.asm) against the C versions, step by step in a Z80 model:
+# python tools/test_move.py
+# games with a seeded random player, one line per step, to diff before and after a change to main.c
+# (takes the -D options of the zcc line, --ghosts 0 to finish mazes; sp1 work per step on stderr):
+# python tools/trace.py --steps 5000 > before.txt
+# python tools/trace.py -DPILL_STORM --ghosts 0 --steps 20000 > storm.txt
+
+# optional: prebuilt sp1 rotation tables, loaded from tape instead of made by sp1_Initialize
+# add -DPREBUILT_ROTTBL to the zcc line above and replace the cat line with:
+# python tools/mkrottbl.py rottbl.bin
+# z88dk.z88dk-appmake +zx -b rottbl.bin -o rottbl.tap --blockname rottbl --org 61952 --noloader
+# cat loader_rottbl.tap screen.tap rottbl.tap game.tap > munchkin_z80.tap
+# (3584 bytes more on tape, about 25 seconds extra loading to save a few frames at startup)
+
+# optional: debug build with stack depth and sp1 block usage on the menu (also at 0xd1d4),
+# add to the zcc line above: -DMEMORY_STATS -Ca-DMEMORY_STATS
+
+# optional: assembly movement kernels (src/move.asm) instead of the C versions,
+# add to the zcc line above: -DASM_MOVEMENT -Ca-DASM_MOVEMENT (check them with tools/test_move.py)
+
+# optional: pre-shifted sprites, drawn without the sp1 rotation tables (faster, 512 bytes per frame),
+# per sprite: add -DPRESHIFT_MUNCHKIN -Ca-DPRESHIFT_MUNCHKIN (6 moving frames, 3086 bytes),
+# -DPRESHIFT_GHOSTS -Ca-DPRESHIFT_GHOSTS (1038 bytes) and/or -DPRESHIFT_PILLS -Ca-DPRESHIFT_PILLS (1038 bytes)
+# to the zcc line above; after editing the sprites remake the shifted frames with:
+# python tools/preshift.py PRESHIFT_MUNCHKIN gfx/munchkin_shifted.asm gfx/munchkin.asm munchkin munchkin_left munchkin_right munchkin_center munchkin_up munchkin_down
+# python tools/preshift.py PRESHIFT_GHOSTS gfx/ghost_shifted.asm gfx/ghost.asm ghost ghost_dead
+# python tools/preshift.py PRESHIFT_PILLS gfx/pill_shifted.asm gfx/pill.asm pill pill_flash
+
+# optional: pills drawn in the background tiles instead of as sp1 sprites (no sp1 blocks for pills),
+# add to the zcc line above: -DPILL_LAYER
+
+# optional: pill storm, 48 pills in the pill layer, moved in 5 groups (one per frame),
+# add to the zcc line above: -DPILL_STORM
+
+# optional: an other number of pills (12 by default, 48 with PILL_STORM), for instance 30 in the
+# pill layer, add to the zcc line above: -DMAX_PILLS=30 -DPILL_LAYER
+
+# optional: debug build with the frames per step of the last game on the menu (how many steps
+# took 1, 2, 3 or 4+ frames), add to the zcc line above: -DFRAME_STATS
+
+# optional: at most about n sprite chars redrawn per frame, pills and eaten ghosts take turns,
+# add to the zcc line above: -DSPRITE_BUDGET=n (for instance 40 with 4 ghosts)
+
+# optional: game loop locked to 50 Hz (-DWFRAMES=1) or 25 Hz (-DWFRAMES=2), a late step is
+# followed by one without drawing, add to the zcc line above: -DFRAME_PACING
+
+# optional: screen drawn in two bands after the interrupt, the top half (beam still in the border)
+# before the bottom half (beam still above it), against tearing, add to the zcc line above: -DBEAM_RACING
+
+# optional: run length packed maze screens, unpacked straight into sp1 at maze start (292 and 286
+# in stead of 432 and 435 bytes), add to the zcc line above: -DPACKED_MAZES -Ca-DPACKED_MAZES
+# (with the 128K build below also add --packed to the mkbank.py line); after editing a maze run:
+# python tools/packmaze.py -o gfx/mazes_packed.asm gfx/tiles.asm gfx/tiles_maze2.asm
+
+# optional: menu logo pre-rendered and zx7 compressed (41 bytes) in stead of printed with sp1,
+# add to the zcc line above: -DMENU_SCREEN -Ca-DMENU_SCREEN and before the zcc line:
+# python tools/mkmenu.py menu.bin
+# z88dk.z88dk-zx7 -f menu.bin
+
+# optional: 128K build, the mazes (screen and tiles) in ram bank 1 instead of in the program,
+# use @zproject128.lst and add -DZX128 -Ca-DZX128 to the zcc line above, then replace the cat line with:
+# python tools/mkbank.py bank1.bin gfx/tiles.asm gfx/tiles_maze2.asm
+# z88dk.z88dk-appmake +zx -b bank1.bin -o bank1.tap --blockname bank1 --org 49152 --noloader
+# cat loader128.tap screen.tap bank1.tap game.tap > munchkin_z128.tap
+# (load from 128 BASIC, the loader pages bank 1 in for the bank1 block)
+
+# optional: test build, key 1 saves the game state in play and key 2 goes back to it,
+# add to the zcc line above: -DGAME_SNAPSHOT
+
 # optional
 # zxtap2wav-1.0.3-linux-amd64 -a -i munchkin_z80.tap munchkin_z80.wav
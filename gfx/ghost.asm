@@ -28,7 +28,6 @@ PUBLIC _ghost_dead
 	defb @11111111, @00000000
 	defb @11111111, @00000000
 	defb @11111111, @00000000
-	defb @11111111, @00000000
 
 ._ghost_dead      
 	defb @11111111, @00000000
@@ -0,0 +1,597 @@
+; PRESHIFT_GHOSTS
+; made by tools/preshift.py from gfx/ghost.asm, do not edit
+
+IFDEF PRESHIFT_GHOSTS
+
+SECTION rodata_user
+
+PUBLIC _ghost_shifted
+PUBLIC _ghost_dead_shifted
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+._ghost_shifted
+	defb @01000010, @10111101
+	defb @10000001, @01111110
+	defb @00101000, @11010111
+	defb @00101000, @11010111
+	defb @00000000, @11111111
+	defb @10000001, @01111110
+	defb @00100100, @11011011
+	defb @10110101, @01001010
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @10100001, @01011110
+	defb @11000000, @00111111
+	defb @10010100, @01101011
+	defb @10010100, @01101011
+	defb @10000000, @01111111
+	defb @11000000, @00111111
+	defb @10010010, @01101101
+	defb @11011010, @00100101
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @01111111, @10000000
+	defb @11111111, @00000000
+	defb @01111111, @10000000
+	defb @01111111, @10000000
+	defb @01111111, @10000000
+	defb @11111111, @00000000
+	defb @01111111, @10000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11010000, @00101111
+	defb @11100000, @00011111
+	defb @11001010, @00110101
+	defb @11001010, @00110101
+	defb @11000000, @00111111
+	defb @11100000, @00011111
+	defb @11001001, @00110110
+	defb @11101101, @00010010
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @10111111, @01000000
+	defb @01111111, @10000000
+	defb @00111111, @11000000
+	defb @00111111, @11000000
+	defb @00111111, @11000000
+	defb @01111111, @10000000
+	defb @00111111, @11000000
+	defb @01111111, @10000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11101000, @00010111
+	defb @11110000, @00001111
+	defb @11100101, @00011010
+	defb @11100101, @00011010
+	defb @11100000, @00011111
+	defb @11110000, @00001111
+	defb @11100100, @00011011
+	defb @11110110, @00001001
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @01011111, @10100000
+	defb @00111111, @11000000
+	defb @00011111, @11100000
+	defb @00011111, @11100000
+	defb @00011111, @11100000
+	defb @00111111, @11000000
+	defb @10011111, @01100000
+	defb @10111111, @01000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11110100, @00001011
+	defb @11111000, @00000111
+	defb @11110010, @00001101
+	defb @11110010, @00001101
+	defb @11110000, @00001111
+	defb @11111000, @00000111
+	defb @11110010, @00001101
+	defb @11111011, @00000100
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @00101111, @11010000
+	defb @00011111, @11100000
+	defb @10001111, @01110000
+	defb @10001111, @01110000
+	defb @00001111, @11110000
+	defb @00011111, @11100000
+	defb @01001111, @10110000
+	defb @01011111, @10100000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111010, @00000101
+	defb @11111100, @00000011
+	defb @11111001, @00000110
+	defb @11111001, @00000110
+	defb @11111000, @00000111
+	defb @11111100, @00000011
+	defb @11111001, @00000110
+	defb @11111101, @00000010
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @00010111, @11101000
+	defb @00001111, @11110000
+	defb @01000111, @10111000
+	defb @01000111, @10111000
+	defb @00000111, @11111000
+	defb @00001111, @11110000
+	defb @00100111, @11011000
+	defb @10101111, @01010000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111101, @00000010
+	defb @11111110, @00000001
+	defb @11111100, @00000011
+	defb @11111100, @00000011
+	defb @11111100, @00000011
+	defb @11111110, @00000001
+	defb @11111100, @00000011
+	defb @11111110, @00000001
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @00001011, @11110100
+	defb @00000111, @11111000
+	defb @10100011, @01011100
+	defb @10100011, @01011100
+	defb @00000011, @11111100
+	defb @00000111, @11111000
+	defb @10010011, @01101100
+	defb @11010111, @00101000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111110, @00000001
+	defb @11111111, @00000000
+	defb @11111110, @00000001
+	defb @11111110, @00000001
+	defb @11111110, @00000001
+	defb @11111111, @00000000
+	defb @11111110, @00000001
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @10000101, @01111010
+	defb @00000011, @11111100
+	defb @01010001, @10101110
+	defb @01010001, @10101110
+	defb @00000001, @11111110
+	defb @00000011, @11111100
+	defb @01001001, @10110110
+	defb @01101011, @10010100
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+._ghost_dead_shifted
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11010111, @00101000
+	defb @11010111, @00101000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @10110101, @01001010
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11101011, @00010100
+	defb @11101011, @00010100
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11011010, @00100101
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11110101, @00001010
+	defb @11110101, @00001010
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11101101, @00010010
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @01111111, @10000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111010, @00000101
+	defb @11111010, @00000101
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11110110, @00001001
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @10111111, @01000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111101, @00000010
+	defb @11111101, @00000010
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111011, @00000100
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @01111111, @10000000
+	defb @01111111, @10000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @01011111, @10100000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111110, @00000001
+	defb @11111110, @00000001
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111101, @00000010
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @10111111, @01000000
+	defb @10111111, @01000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @10101111, @01010000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111110, @00000001
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @01011111, @10100000
+	defb @01011111, @10100000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11010111, @00101000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @10101111, @01010000
+	defb @10101111, @01010000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @01101011, @10010100
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+ENDIF
@@ -0,0 +1,89 @@
+; PACKED_MAZES
+; made by tools/packmaze.py from gfx/tiles.asm gfx/tiles_maze2.asm, do not edit
+
+IFDEF PACKED_MAZES
+
+SECTION rodata_user
+
+PUBLIC _ptiles_packed
+
+._ptiles_packed
+	defb 0x7f, 0x80, 0x03, 0x80, 0x81, 0x0b, 0x82, 0x83
+	defb 0x0e, 0x82, 0x84, 0x04, 0x80, 0x85, 0x0b, 0x80
+	defb 0x85, 0x0e, 0x80, 0x85, 0x04, 0x80, 0x85, 0x80
+	defb 0x80, 0x86, 0x82, 0x82, 0x87, 0x80, 0x80, 0x88
+	defb 0x80, 0x80, 0x89, 0x80, 0x80, 0x86, 0x82, 0x82
+	defb 0x87, 0x80, 0x80, 0x86, 0x82, 0x82, 0x87, 0x80
+	defb 0x80, 0x85, 0x04, 0x80, 0x85, 0x08, 0x80, 0x85
+	defb 0x11, 0x80, 0x85, 0x04, 0x80, 0x85, 0x80, 0x80
+	defb 0x88, 0x80, 0x80, 0x88, 0x80, 0x80, 0x89, 0x80
+	defb 0x80, 0x86, 0x82, 0x82, 0x83, 0x82, 0x82, 0x87
+	defb 0x80, 0x80, 0x88, 0x80, 0x80, 0x88, 0x80, 0x80
+	defb 0x85, 0x04, 0x80, 0x85, 0x80, 0x80, 0x85, 0x80
+	defb 0x80, 0x85, 0x08, 0x80, 0x85, 0x05, 0x80, 0x85
+	defb 0x80, 0x80, 0x85, 0x80, 0x80, 0x85, 0x04, 0x80
+	defb 0x85, 0x80, 0x80, 0x89, 0x80, 0x80, 0x8a, 0x82
+	defb 0x82, 0x87, 0x05, 0x80, 0x89, 0x80, 0x80, 0x86
+	defb 0x82, 0x82, 0x8b, 0x80, 0x80, 0x89, 0x80, 0x80
+	defb 0x85, 0x04, 0x80, 0x85, 0x05, 0x80, 0x85, 0x0e
+	defb 0x80, 0x85, 0x05, 0x80, 0x85, 0x04, 0x80, 0x8c
+	defb 0x82, 0x82, 0x87, 0x80, 0x80, 0x89, 0x80, 0x80
+	defb 0x88, 0x80, 0x80, 0x81, 0x82, 0x82, 0x84, 0x80
+	defb 0x80, 0x88, 0x80, 0x80, 0x89, 0x80, 0x80, 0x86
+	defb 0x82, 0x82, 0x8d, 0x0d, 0x80, 0x85, 0x80, 0x80
+	defb 0x85, 0x80, 0x80, 0x85, 0x80, 0x80, 0x85, 0x0d
+	defb 0x80, 0x81, 0x82, 0x82, 0x87, 0x80, 0x80, 0x88
+	defb 0x80, 0x80, 0x89, 0x80, 0x80, 0x89, 0x80, 0x80
+	defb 0x89, 0x80, 0x80, 0x89, 0x80, 0x80, 0x88, 0x80
+	defb 0x80, 0x86, 0x82, 0x82, 0x84, 0x04, 0x80, 0x85
+	defb 0x05, 0x80, 0x85, 0x0e, 0x80, 0x85, 0x05, 0x80
+	defb 0x85, 0x04, 0x80, 0x85, 0x80, 0x80, 0x86, 0x82
+	defb 0x82, 0x8d, 0x80, 0x80, 0x88, 0x80, 0x80, 0x86
+	defb 0x82, 0x82, 0x84, 0x80, 0x80, 0x86, 0x82, 0x82
+	defb 0x8e, 0x82, 0x82, 0x8f, 0x80, 0x80, 0x85, 0x04
+	defb 0x80, 0x85, 0x08, 0x80, 0x85, 0x05, 0x80, 0x85
+	defb 0x0b, 0x80, 0x85, 0x04, 0x80, 0x8c, 0x08, 0x82
+	defb 0x8e, 0x05, 0x82, 0x8e, 0x0b, 0x82, 0x8d, 0x7f
+	defb 0x80, 0x23, 0x80, 0x00
+
+PUBLIC _ptiles_maze2_packed
+
+._ptiles_maze2_packed
+	defb 0x7f, 0x80, 0x03, 0x80, 0x81, 0x82, 0x82, 0x83
+	defb 0x0b, 0x82, 0x83, 0x0b, 0x82, 0x84, 0x04, 0x80
+	defb 0x85, 0x80, 0x80, 0x85, 0x0b, 0x80, 0x85, 0x0b
+	defb 0x80, 0x85, 0x04, 0x80, 0x85, 0x80, 0x80, 0x86
+	defb 0x08, 0x82, 0x87, 0x80, 0x80, 0x85, 0x80, 0x80
+	defb 0x88, 0x82, 0x82, 0x84, 0x80, 0x80, 0x88, 0x82
+	defb 0x82, 0x89, 0x04, 0x80, 0x85, 0x0e, 0x80, 0x85
+	defb 0x05, 0x80, 0x85, 0x05, 0x80, 0x85, 0x04, 0x80
+	defb 0x85, 0x80, 0x80, 0x8a, 0x80, 0x80, 0x88, 0x82
+	defb 0x82, 0x84, 0x80, 0x80, 0x88, 0x82, 0x82, 0x89
+	defb 0x80, 0x80, 0x8a, 0x80, 0x80, 0x8b, 0x80, 0x80
+	defb 0x8a, 0x80, 0x80, 0x85, 0x04, 0x80, 0x85, 0x80
+	defb 0x80, 0x85, 0x05, 0x80, 0x85, 0x05, 0x80, 0x85
+	defb 0x80, 0x80, 0x85, 0x05, 0x80, 0x85, 0x80, 0x80
+	defb 0x85, 0x04, 0x80, 0x85, 0x80, 0x80, 0x86, 0x82
+	defb 0x82, 0x87, 0x80, 0x80, 0x8b, 0x80, 0x80, 0x8a
+	defb 0x80, 0x80, 0x8c, 0x82, 0x82, 0x8d, 0x80, 0x80
+	defb 0x8a, 0x80, 0x80, 0x8b, 0x80, 0x80, 0x85, 0x04
+	defb 0x80, 0x85, 0x0b, 0x80, 0x85, 0x80, 0x80, 0x85
+	defb 0x05, 0x80, 0x85, 0x05, 0x80, 0x85, 0x04, 0x80
+	defb 0x86, 0x82, 0x82, 0x87, 0x80, 0x80, 0x88, 0x05
+	defb 0x82, 0x8e, 0x82, 0x82, 0x89, 0x80, 0x80, 0x81
+	defb 0x82, 0x82, 0x8f, 0x05, 0x82, 0x8d, 0x10, 0x80
+	defb 0x85, 0x80, 0x80, 0x85, 0x80, 0x80, 0x85, 0x0d
+	defb 0x80, 0x81, 0x05, 0x82, 0x87, 0x80, 0x80, 0x8a
+	defb 0x80, 0x80, 0x85, 0x80, 0x80, 0x86, 0x82, 0x82
+	defb 0x8d, 0x80, 0x80, 0x8a, 0x80, 0x80, 0x88, 0x82
+	defb 0x82, 0x84, 0x04, 0x80, 0x85, 0x08, 0x80, 0x85
+	defb 0x80, 0x80, 0x85, 0x08, 0x80, 0x85, 0x05, 0x80
+	defb 0x85, 0x04, 0x80, 0x85, 0x80, 0x80, 0x88, 0x82
+	defb 0x82, 0x87, 0x80, 0x80, 0x8b, 0x80, 0x80, 0x85
+	defb 0x80, 0x80, 0x88, 0x82, 0x82, 0x87, 0x80, 0x80
+	defb 0x86, 0x82, 0x82, 0x87, 0x80, 0x80, 0x85, 0x04
+	defb 0x80, 0x85, 0x0b, 0x80, 0x85, 0x0e, 0x80, 0x85
+	defb 0x04, 0x80, 0x86, 0x0b, 0x82, 0x8f, 0x0e, 0x82
+	defb 0x8d, 0x7f, 0x80, 0x23, 0x80, 0x00
+
+ENDIF
@@ -1,7 +1,13 @@
+; MENU_SCREEN: the menu logo made by tools/mkmenu.py and compressed with z88dk-zx7 (see build.sh)
+
+IFDEF MENU_SCREEN
+
 SECTION rodata_user
 
 PUBLIC _menu
 
 _menu:
 
-   BINARY "menu.scr.zx7"
+   BINARY "menu.bin.zx7"
+
+ENDIF
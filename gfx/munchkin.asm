@@ -227,8 +227,6 @@ PUBLIC _munchkin_dying5
 	defb @11111111, @00000000
 	defb @11111111, @00000000
 	defb @11111111, @00000000
-	defb @11111111, @00000000
-	defb @11111111, @00000000	
 	
 ._munchkin_dying4
 	defb @11111111, @00000000
@@ -0,0 +1,1757 @@
+; PRESHIFT_MUNCHKIN
+; made by tools/preshift.py from gfx/munchkin.asm, do not edit
+
+IFDEF PRESHIFT_MUNCHKIN
+
+SECTION rodata_user
+
+PUBLIC _munchkin_shifted
+PUBLIC _munchkin_left_shifted
+PUBLIC _munchkin_right_shifted
+PUBLIC _munchkin_center_shifted
+PUBLIC _munchkin_up_shifted
+PUBLIC _munchkin_down_shifted
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+._munchkin_shifted
+	defb @01111110, @10000001
+	defb @10100101, @01011010
+	defb @11000011, @00111100
+	defb @10100101, @01011010
+	defb @00000000, @11111111
+	defb @01000010, @10111101
+	defb @10111101, @01000010
+	defb @11000011, @00111100
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @10111111, @01000000
+	defb @11010010, @00101101
+	defb @11100001, @00011110
+	defb @11010010, @00101101
+	defb @10000000, @01111111
+	defb @10100001, @01011110
+	defb @11011110, @00100001
+	defb @11100001, @00011110
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @01111111, @10000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @01111111, @10000000
+	defb @01111111, @10000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11011111, @00100000
+	defb @11101001, @00010110
+	defb @11110000, @00001111
+	defb @11101001, @00010110
+	defb @11000000, @00111111
+	defb @11010000, @00101111
+	defb @11101111, @00010000
+	defb @11110000, @00001111
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @10111111, @01000000
+	defb @01111111, @10000000
+	defb @11111111, @00000000
+	defb @01111111, @10000000
+	defb @00111111, @11000000
+	defb @10111111, @01000000
+	defb @01111111, @10000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11101111, @00010000
+	defb @11110100, @00001011
+	defb @11111000, @00000111
+	defb @11110100, @00001011
+	defb @11100000, @00011111
+	defb @11101000, @00010111
+	defb @11110111, @00001000
+	defb @11111000, @00000111
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11011111, @00100000
+	defb @10111111, @01000000
+	defb @01111111, @10000000
+	defb @10111111, @01000000
+	defb @00011111, @11100000
+	defb @01011111, @10100000
+	defb @10111111, @01000000
+	defb @01111111, @10000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11110111, @00001000
+	defb @11111010, @00000101
+	defb @11111100, @00000011
+	defb @11111010, @00000101
+	defb @11110000, @00001111
+	defb @11110100, @00001011
+	defb @11111011, @00000100
+	defb @11111100, @00000011
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11101111, @00010000
+	defb @01011111, @10100000
+	defb @00111111, @11000000
+	defb @01011111, @10100000
+	defb @00001111, @11110000
+	defb @00101111, @11010000
+	defb @11011111, @00100000
+	defb @00111111, @11000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111011, @00000100
+	defb @11111101, @00000010
+	defb @11111110, @00000001
+	defb @11111101, @00000010
+	defb @11111000, @00000111
+	defb @11111010, @00000101
+	defb @11111101, @00000010
+	defb @11111110, @00000001
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11110111, @00001000
+	defb @00101111, @11010000
+	defb @00011111, @11100000
+	defb @00101111, @11010000
+	defb @00000111, @11111000
+	defb @00010111, @11101000
+	defb @11101111, @00010000
+	defb @00011111, @11100000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111101, @00000010
+	defb @11111110, @00000001
+	defb @11111111, @00000000
+	defb @11111110, @00000001
+	defb @11111100, @00000011
+	defb @11111101, @00000010
+	defb @11111110, @00000001
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111011, @00000100
+	defb @10010111, @01101000
+	defb @00001111, @11110000
+	defb @10010111, @01101000
+	defb @00000011, @11111100
+	defb @00001011, @11110100
+	defb @11110111, @00001000
+	defb @00001111, @11110000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111110, @00000001
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111110, @00000001
+	defb @11111110, @00000001
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111101, @00000010
+	defb @01001011, @10110100
+	defb @10000111, @01111000
+	defb @01001011, @10110100
+	defb @00000001, @11111110
+	defb @10000101, @01111010
+	defb @01111011, @10000100
+	defb @10000111, @01111000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+._munchkin_left_shifted
+	defb @00000101, @11111010
+	defb @10010011, @01101100
+	defb @11000011, @00111100
+	defb @11100001, @00011110
+	defb @11000011, @00111100
+	defb @10000111, @01111000
+	defb @00001111, @11110000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @10000010, @01111101
+	defb @11001001, @00110110
+	defb @11100001, @00011110
+	defb @11110000, @00001111
+	defb @11100001, @00011110
+	defb @11000011, @00111100
+	defb @10000111, @01111000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11000001, @00111110
+	defb @11100100, @00011011
+	defb @11110000, @00001111
+	defb @11111000, @00000111
+	defb @11110000, @00001111
+	defb @11100001, @00011110
+	defb @11000011, @00111100
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @01111111, @10000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @01111111, @10000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11100000, @00011111
+	defb @11110010, @00001101
+	defb @11111000, @00000111
+	defb @11111100, @00000011
+	defb @11111000, @00000111
+	defb @11110000, @00001111
+	defb @11100001, @00011110
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @10111111, @01000000
+	defb @01111111, @10000000
+	defb @01111111, @10000000
+	defb @00111111, @11000000
+	defb @01111111, @10000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11110000, @00001111
+	defb @11111001, @00000110
+	defb @11111100, @00000011
+	defb @11111110, @00000001
+	defb @11111100, @00000011
+	defb @11111000, @00000111
+	defb @11110000, @00001111
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @01011111, @10100000
+	defb @00111111, @11000000
+	defb @00111111, @11000000
+	defb @00011111, @11100000
+	defb @00111111, @11000000
+	defb @01111111, @10000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111000, @00000111
+	defb @11111100, @00000011
+	defb @11111110, @00000001
+	defb @11111111, @00000000
+	defb @11111110, @00000001
+	defb @11111100, @00000011
+	defb @11111000, @00000111
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @00101111, @11010000
+	defb @10011111, @01100000
+	defb @00011111, @11100000
+	defb @00001111, @11110000
+	defb @00011111, @11100000
+	defb @00111111, @11000000
+	defb @01111111, @10000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111100, @00000011
+	defb @11111110, @00000001
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111110, @00000001
+	defb @11111100, @00000011
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @00010111, @11101000
+	defb @01001111, @10110000
+	defb @00001111, @11110000
+	defb @10000111, @01111000
+	defb @00001111, @11110000
+	defb @00011111, @11100000
+	defb @00111111, @11000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111110, @00000001
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111110, @00000001
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @00001011, @11110100
+	defb @00100111, @11011000
+	defb @10000111, @01111000
+	defb @11000011, @00111100
+	defb @10000111, @01111000
+	defb @00001111, @11110000
+	defb @00011111, @11100000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+._munchkin_right_shifted
+	defb @01000001, @10111110
+	defb @10010011, @01101100
+	defb @10000111, @01111000
+	defb @00011111, @11100000
+	defb @10001111, @01110000
+	defb @11000111, @00111000
+	defb @11100001, @00011110
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @10100000, @01011111
+	defb @11001001, @00110110
+	defb @11000011, @00111100
+	defb @10001111, @01110000
+	defb @11000111, @00111000
+	defb @11100011, @00011100
+	defb @11110000, @00001111
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11010000, @00101111
+	defb @11100100, @00011011
+	defb @11100001, @00011110
+	defb @11000111, @00111000
+	defb @11100011, @00011100
+	defb @11110001, @00001110
+	defb @11111000, @00000111
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @01111111, @10000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @01111111, @10000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11101000, @00010111
+	defb @11110010, @00001101
+	defb @11110000, @00001111
+	defb @11100011, @00011100
+	defb @11110001, @00001110
+	defb @11111000, @00000111
+	defb @11111100, @00000011
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @00111111, @11000000
+	defb @01111111, @10000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @00111111, @11000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11110100, @00001011
+	defb @11111001, @00000110
+	defb @11111000, @00000111
+	defb @11110001, @00001110
+	defb @11111000, @00000111
+	defb @11111100, @00000011
+	defb @11111110, @00000001
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @00011111, @11100000
+	defb @00111111, @11000000
+	defb @01111111, @10000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @01111111, @10000000
+	defb @00011111, @11100000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111010, @00000101
+	defb @11111100, @00000011
+	defb @11111100, @00000011
+	defb @11111000, @00000111
+	defb @11111100, @00000011
+	defb @11111110, @00000001
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @00001111, @11110000
+	defb @10011111, @01100000
+	defb @00111111, @11000000
+	defb @11111111, @00000000
+	defb @01111111, @10000000
+	defb @00111111, @11000000
+	defb @00001111, @11110000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111101, @00000010
+	defb @11111110, @00000001
+	defb @11111110, @00000001
+	defb @11111100, @00000011
+	defb @11111110, @00000001
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @00000111, @11111000
+	defb @01001111, @10110000
+	defb @00011111, @11100000
+	defb @01111111, @10000000
+	defb @00111111, @11000000
+	defb @00011111, @11100000
+	defb @10000111, @01111000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111110, @00000001
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111110, @00000001
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @10000011, @01111100
+	defb @00100111, @11011000
+	defb @00001111, @11110000
+	defb @00111111, @11000000
+	defb @00011111, @11100000
+	defb @10001111, @01110000
+	defb @11000011, @00111100
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+._munchkin_center_shifted
+	defb @11100111, @00011000
+	defb @11000011, @00111100
+	defb @10000001, @01111110
+	defb @00000000, @11111111
+	defb @10000001, @01111110
+	defb @11000011, @00111100
+	defb @11100111, @00011000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11110011, @00001100
+	defb @11100001, @00011110
+	defb @11000000, @00111111
+	defb @10000000, @01111111
+	defb @11000000, @00111111
+	defb @11100001, @00011110
+	defb @11110011, @00001100
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @01111111, @10000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111001, @00000110
+	defb @11110000, @00001111
+	defb @11100000, @00011111
+	defb @11000000, @00111111
+	defb @11100000, @00011111
+	defb @11110000, @00001111
+	defb @11111001, @00000110
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @01111111, @10000000
+	defb @00111111, @11000000
+	defb @01111111, @10000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111100, @00000011
+	defb @11111000, @00000111
+	defb @11110000, @00001111
+	defb @11100000, @00011111
+	defb @11110000, @00001111
+	defb @11111000, @00000111
+	defb @11111100, @00000011
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @01111111, @10000000
+	defb @00111111, @11000000
+	defb @00011111, @11100000
+	defb @00111111, @11000000
+	defb @01111111, @10000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111110, @00000001
+	defb @11111100, @00000011
+	defb @11111000, @00000111
+	defb @11110000, @00001111
+	defb @11111000, @00000111
+	defb @11111100, @00000011
+	defb @11111110, @00000001
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @01111111, @10000000
+	defb @00111111, @11000000
+	defb @00011111, @11100000
+	defb @00001111, @11110000
+	defb @00011111, @11100000
+	defb @00111111, @11000000
+	defb @01111111, @10000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111110, @00000001
+	defb @11111100, @00000011
+	defb @11111000, @00000111
+	defb @11111100, @00000011
+	defb @11111110, @00000001
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @00111111, @11000000
+	defb @00011111, @11100000
+	defb @00001111, @11110000
+	defb @00000111, @11111000
+	defb @00001111, @11110000
+	defb @00011111, @11100000
+	defb @00111111, @11000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111110, @00000001
+	defb @11111100, @00000011
+	defb @11111110, @00000001
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @10011111, @01100000
+	defb @00001111, @11110000
+	defb @00000111, @11111000
+	defb @00000011, @11111100
+	defb @00000111, @11111000
+	defb @00001111, @11110000
+	defb @10011111, @01100000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111110, @00000001
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11001111, @00110000
+	defb @10000111, @01111000
+	defb @00000011, @11111100
+	defb @00000001, @11111110
+	defb @00000011, @11111100
+	defb @10000111, @01111000
+	defb @11001111, @00110000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+._munchkin_up_shifted
+	defb @01111110, @10000001
+	defb @00111100, @11000011
+	defb @00011000, @11100111
+	defb @00010010, @11101101
+	defb @10000000, @01111111
+	defb @11000001, @00111110
+	defb @11110110, @00001001
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @10111111, @01000000
+	defb @10011110, @01100001
+	defb @10001100, @01110011
+	defb @10001001, @01110110
+	defb @11000000, @00111111
+	defb @11100000, @00011111
+	defb @11111011, @00000100
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @01111111, @10000000
+	defb @01111111, @10000000
+	defb @01111111, @10000000
+	defb @01111111, @10000000
+	defb @01111111, @10000000
+	defb @11111111, @00000000
+	defb @01111111, @10000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11011111, @00100000
+	defb @11001111, @00110000
+	defb @11000110, @00111001
+	defb @11000100, @00111011
+	defb @11100000, @00011111
+	defb @11110000, @00001111
+	defb @11111101, @00000010
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @10111111, @01000000
+	defb @00111111, @11000000
+	defb @00111111, @11000000
+	defb @10111111, @01000000
+	defb @00111111, @11000000
+	defb @01111111, @10000000
+	defb @10111111, @01000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11101111, @00010000
+	defb @11100111, @00011000
+	defb @11100011, @00011100
+	defb @11100010, @00011101
+	defb @11110000, @00001111
+	defb @11111000, @00000111
+	defb @11111110, @00000001
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11011111, @00100000
+	defb @10011111, @01100000
+	defb @00011111, @11100000
+	defb @01011111, @10100000
+	defb @00011111, @11100000
+	defb @00111111, @11000000
+	defb @11011111, @00100000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11110111, @00001000
+	defb @11110011, @00001100
+	defb @11110001, @00001110
+	defb @11110001, @00001110
+	defb @11111000, @00000111
+	defb @11111100, @00000011
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11101111, @00010000
+	defb @11001111, @00110000
+	defb @10001111, @01110000
+	defb @00101111, @11010000
+	defb @00001111, @11110000
+	defb @00011111, @11100000
+	defb @01101111, @10010000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111011, @00000100
+	defb @11111001, @00000110
+	defb @11111000, @00000111
+	defb @11111000, @00000111
+	defb @11111100, @00000011
+	defb @11111110, @00000001
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11110111, @00001000
+	defb @11100111, @00011000
+	defb @11000111, @00111000
+	defb @10010111, @01101000
+	defb @00000111, @11111000
+	defb @00001111, @11110000
+	defb @10110111, @01001000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111101, @00000010
+	defb @11111100, @00000011
+	defb @11111100, @00000011
+	defb @11111100, @00000011
+	defb @11111110, @00000001
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111011, @00000100
+	defb @11110011, @00001100
+	defb @01100011, @10011100
+	defb @01001011, @10110100
+	defb @00000011, @11111100
+	defb @00000111, @11111000
+	defb @11011011, @00100100
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111110, @00000001
+	defb @11111110, @00000001
+	defb @11111110, @00000001
+	defb @11111110, @00000001
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111101, @00000010
+	defb @01111001, @10000110
+	defb @00110001, @11001110
+	defb @00100101, @11011010
+	defb @00000001, @11111110
+	defb @10000011, @01111100
+	defb @11101101, @00010010
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+._munchkin_down_shifted
+	defb @11110110, @00001001
+	defb @11000001, @00111110
+	defb @10000000, @01111111
+	defb @00010010, @11101101
+	defb @00011000, @11100111
+	defb @00111100, @11000011
+	defb @01111110, @10000001
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111011, @00000100
+	defb @11100000, @00011111
+	defb @11000000, @00111111
+	defb @10001001, @01110110
+	defb @10001100, @01110011
+	defb @10011110, @01100001
+	defb @10111111, @01000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @01111111, @10000000
+	defb @11111111, @00000000
+	defb @01111111, @10000000
+	defb @01111111, @10000000
+	defb @01111111, @10000000
+	defb @01111111, @10000000
+	defb @01111111, @10000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111101, @00000010
+	defb @11110000, @00001111
+	defb @11100000, @00011111
+	defb @11000100, @00111011
+	defb @11000110, @00111001
+	defb @11001111, @00110000
+	defb @11011111, @00100000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @10111111, @01000000
+	defb @01111111, @10000000
+	defb @00111111, @11000000
+	defb @10111111, @01000000
+	defb @00111111, @11000000
+	defb @00111111, @11000000
+	defb @10111111, @01000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111110, @00000001
+	defb @11111000, @00000111
+	defb @11110000, @00001111
+	defb @11100010, @00011101
+	defb @11100011, @00011100
+	defb @11100111, @00011000
+	defb @11101111, @00010000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11011111, @00100000
+	defb @00111111, @11000000
+	defb @00011111, @11100000
+	defb @01011111, @10100000
+	defb @00011111, @11100000
+	defb @10011111, @01100000
+	defb @11011111, @00100000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111100, @00000011
+	defb @11111000, @00000111
+	defb @11110001, @00001110
+	defb @11110001, @00001110
+	defb @11110011, @00001100
+	defb @11110111, @00001000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @01101111, @10010000
+	defb @00011111, @11100000
+	defb @00001111, @11110000
+	defb @00101111, @11010000
+	defb @10001111, @01110000
+	defb @11001111, @00110000
+	defb @11101111, @00010000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111110, @00000001
+	defb @11111100, @00000011
+	defb @11111000, @00000111
+	defb @11111000, @00000111
+	defb @11111001, @00000110
+	defb @11111011, @00000100
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @10110111, @01001000
+	defb @00001111, @11110000
+	defb @00000111, @11111000
+	defb @10010111, @01101000
+	defb @11000111, @00111000
+	defb @11100111, @00011000
+	defb @11110111, @00001000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111110, @00000001
+	defb @11111100, @00000011
+	defb @11111100, @00000011
+	defb @11111100, @00000011
+	defb @11111101, @00000010
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11011011, @00100100
+	defb @00000111, @11111000
+	defb @00000011, @11111100
+	defb @01001011, @10110100
+	defb @01100011, @10011100
+	defb @11110011, @00001100
+	defb @11111011, @00000100
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111110, @00000001
+	defb @11111110, @00000001
+	defb @11111110, @00000001
+	defb @11111110, @00000001
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11101101, @00010010
+	defb @10000011, @01111100
+	defb @00000001, @11111110
+	defb @00100101, @11011010
+	defb @00110001, @11001110
+	defb @01111001, @10000110
+	defb @11111101, @00000010
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+ENDIF
@@ -19,7 +19,6 @@ PUBLIC _pill_flash
 	defb @11000111, @00111000
 	defb @11111111, @00000000
 	defb @11111111, @00000000
-	defb @11111111, @00000000
 
 	defb @11111111, @00000000
 	defb @11111111, @00000000
@@ -0,0 +1,597 @@
+; PRESHIFT_PILLS
+; made by tools/preshift.py from gfx/pill.asm, do not edit
+
+IFDEF PRESHIFT_PILLS
+
+SECTION rodata_user
+
+PUBLIC _pill_shifted
+PUBLIC _pill_flash_shifted
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+._pill_shifted
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11000111, @00111000
+	defb @11000111, @00111000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11100011, @00011100
+	defb @11100011, @00011100
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11110001, @00001110
+	defb @11110001, @00001110
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111000, @00000111
+	defb @11111000, @00000111
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111100, @00000011
+	defb @11111100, @00000011
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @01111111, @10000000
+	defb @01111111, @10000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111110, @00000001
+	defb @11111110, @00000001
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @00111111, @11000000
+	defb @00111111, @11000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @00011111, @11100000
+	defb @00011111, @11100000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @10001111, @01110000
+	defb @10001111, @01110000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+._pill_flash_shifted
+	defb @11111111, @00000000
+	defb @10011001, @01100110
+	defb @11000011, @00111100
+	defb @11100111, @00011000
+	defb @11000011, @00111100
+	defb @10011001, @01100110
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11001100, @00110011
+	defb @11100001, @00011110
+	defb @11110011, @00001100
+	defb @11100001, @00011110
+	defb @11001100, @00110011
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11100110, @00011001
+	defb @11110000, @00001111
+	defb @11111001, @00000110
+	defb @11110000, @00001111
+	defb @11100110, @00011001
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @01111111, @10000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @01111111, @10000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11110011, @00001100
+	defb @11111000, @00000111
+	defb @11111100, @00000011
+	defb @11111000, @00000111
+	defb @11110011, @00001100
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @00111111, @11000000
+	defb @01111111, @10000000
+	defb @11111111, @00000000
+	defb @01111111, @10000000
+	defb @00111111, @11000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111001, @00000110
+	defb @11111100, @00000011
+	defb @11111110, @00000001
+	defb @11111100, @00000011
+	defb @11111001, @00000110
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @10011111, @01100000
+	defb @00111111, @11000000
+	defb @01111111, @10000000
+	defb @00111111, @11000000
+	defb @10011111, @01100000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111100, @00000011
+	defb @11111110, @00000001
+	defb @11111111, @00000000
+	defb @11111110, @00000001
+	defb @11111100, @00000011
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11001111, @00110000
+	defb @00011111, @11100000
+	defb @00111111, @11000000
+	defb @00011111, @11100000
+	defb @11001111, @00110000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111110, @00000001
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111110, @00000001
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @01100111, @10011000
+	defb @00001111, @11110000
+	defb @10011111, @01100000
+	defb @00001111, @11110000
+	defb @01100111, @10011000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @00110011, @11001100
+	defb @10000111, @01111000
+	defb @11001111, @00110000
+	defb @10000111, @01111000
+	defb @00110011, @11001100
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+	defb @11111111, @00000000
+
+ENDIF
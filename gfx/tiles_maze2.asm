@@ -8,6 +8,8 @@
 
 SECTION rodata_user
 
+IFNDEF PACKED_MAZES                 ; in gfx/mazes_packed.asm
+
 PUBLIC _ptiles_maze2
 
 _ptiles_maze2:
@@ -68,6 +70,8 @@ defb 0x80, 0x0f, 0x0d, 0x0e, 0x20, 0x80, 0x0f, 0x0d
 defb 0x0e, 0x20, 0x80, 0x0f, 0x0d, 0x0e, 0x20, 0x80
 defb 0x0f, 0x0d, 0x00
 
+ENDIF
+
 ; #define TILES_MAZE2_BASE 128
 ; #define TILES_MAZE2_LEN 16
 
@@ -0,0 +1,169 @@
+SECTION rodata_user
+
+; 8x8 graphics for the maze lines and the menu logo (sp1_TileEntry)
+
+PUBLIC _udg_line_vert
+PUBLIC _udg_line_hori
+PUBLIC _udg_top_left
+PUBLIC _udg_top_right
+PUBLIC _udg_bottom_left
+PUBLIC _udg_bottom_right
+PUBLIC _udg_line_hori_right
+PUBLIC _udg_line_hori_left
+PUBLIC _udg_line_vert_bottom
+PUBLIC _udg_line_vert_top
+PUBLIC _udg_line_hori_left_maze2
+PUBLIC _udg_line_vert_top_maze2
+PUBLIC _udg_bottom_left_maze2
+PUBLIC _udg_top_left_maze2
+PUBLIC _udg_square_block
+
+._udg_line_vert
+	defb @00011000
+	defb @00011000
+	defb @00011000
+	defb @00011000
+	defb @00011000
+	defb @00011000
+	defb @00011000
+	defb @00011000
+
+._udg_line_hori
+	defb @00000000
+	defb @00000000
+	defb @00000000
+	defb @11111111
+	defb @11111111
+	defb @00000000
+	defb @00000000
+	defb @00000000
+
+._udg_top_left
+	defb @00000000
+	defb @00000000
+	defb @00000000
+	defb @00011111
+	defb @00011111
+	defb @00011000
+	defb @00011000
+	defb @00011000
+
+._udg_top_right
+	defb @00000000
+	defb @00000000
+	defb @00000000
+	defb @11111000
+	defb @11111000
+	defb @00011000
+	defb @00011000
+	defb @00011000
+
+._udg_bottom_left
+	defb @00011000
+	defb @00011000
+	defb @00011000
+	defb @00011111
+	defb @00011111
+	defb @00000000
+	defb @00000000
+	defb @00000000
+
+._udg_bottom_right
+	defb @00011000
+	defb @00011000
+	defb @00011000
+	defb @11111000
+	defb @11111000
+	defb @00000000
+	defb @00000000
+	defb @00000000
+
+._udg_line_hori_right
+	defb @00000000
+	defb @00000000
+	defb @00000000
+	defb @00011111
+	defb @00011111
+	defb @00000000
+	defb @00000000
+	defb @00000000
+
+._udg_line_hori_left
+	defb @00000000
+	defb @00000000
+	defb @00000000
+	defb @11111000
+	defb @11111000
+	defb @00000000
+	defb @00000000
+	defb @00000000
+
+._udg_line_vert_bottom
+	defb @00011000
+	defb @00011000
+	defb @00011000
+	defb @00011000
+	defb @00011000
+	defb @00000000
+	defb @00000000
+	defb @00000000
+
+._udg_line_vert_top
+	defb @00000000
+	defb @00000000
+	defb @00000000
+	defb @00011000
+	defb @00011000
+	defb @00011000
+	defb @00011000
+	defb @00011000
+
+._udg_line_hori_left_maze2
+	defb @00011000
+	defb @00011000
+	defb @00011000
+	defb @11111111
+	defb @11111111
+	defb @00000000
+	defb @00000000
+	defb @00000000
+
+._udg_line_vert_top_maze2
+	defb @00011000
+	defb @00011000
+	defb @00011000
+	defb @11111000
+	defb @11111000
+	defb @00011000
+	defb @00011000
+	defb @00011000
+
+._udg_bottom_left_maze2
+	defb @00011000
+	defb @00011000
+	defb @00011000
+	defb @00011111
+	defb @00011111
+	defb @00011000
+	defb @00011000
+	defb @00011000
+
+._udg_top_left_maze2
+	defb @00011000
+	defb @00011000
+	defb @00011000
+	defb @11111111
+	defb @11111111
+	defb @00011000
+	defb @00011000
+	defb @00011000
+
+._udg_square_block
+	defb @11111111
+	defb @11111111
+	defb @11111111
+	defb @11111111
+	defb @11111111
+	defb @11111111
+	defb @11111111
+	defb @11111111
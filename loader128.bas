@@ -0,0 +1 @@
+10 BORDER 0: PAPER 0: INK 0: CLS: CLEAR 24099: POKE 23739,111: LOAD ""SCREEN$: POKE 23388,17: OUT 32765,17: LOAD ""CODE: POKE 23388,16: OUT 32765,16: LOAD ""CODE: PAUSE 0: RANDOMIZE USR 25124
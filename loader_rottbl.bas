@@ -0,0 +1 @@
+10 BORDER 0: PAPER 0: INK 0: CLS: CLEAR 24099: POKE 23739,111: LOAD ""SCREEN$: LOAD ""CODE: LOAD ""CODE: PAUSE 0: RANDOMIZE USR 25124
@@ -0,0 +1,100 @@
+
+; 128K bank switching, only in the build with -DZX128 (see build.sh).
+;
+; Banks are paged in at 0xc000, where the 48K memory map has the end of the
+; program, the stack, the im2 table and the sp1 tables. So a bank is only
+; paged in with interrupts off, without using the stack, and copied in
+; pieces of up to 256 bytes to a buffer in TEMPMEM (below 0xc000) first.
+; Not for the game loop: it is used in start_new_maze() only.
+
+IFDEF ZX128
+
+SECTION code_user
+
+PUBLIC _bank_copy
+
+EXTERN _TEMPMEM
+
+defc BANKM       = 0x5b5c      ; 128K system variable, last value sent to port 0x7ffd
+defc BANK_BUFFER = _TEMPMEM + 768   ; last 256 bytes of TEMPMEM (ARENA_SIZE in main.c)
+
+
+_bank_copy:
+
+; void bank_copy(bank_copy_type *copy)
+; fastcall linkage: hl = copy (bank, src, dst, len)
+;
+; this code must be below 0xc000 (tools/memmap.py checks)
+
+   ld a,(BANKM)
+   and $f8
+   or (hl)                     ; ram bank
+   ld (bank_value),a
+   inc hl
+   ld e,(hl)
+   inc hl
+   ld d,(hl)
+   inc hl
+   push de                     ; src
+   ld e,(hl)
+   inc hl
+   ld d,(hl)                   ; de = dst
+   inc hl
+   ld c,(hl)
+   inc hl
+   ld b,(hl)                   ; bc = len
+   pop hl                      ; hl = src
+
+copy_loop:
+
+   ld a,b
+   or c
+   ret z
+
+   push bc                     ; len
+   ld a,b
+   or a
+   jr z, copy_piece            ; less than 256 bytes left
+   ld bc,256
+
+copy_piece:
+
+   push bc                     ; piece
+   push de                     ; dst
+   ld de,BANK_BUFFER
+   ld a,(bank_value)
+
+   di
+   exx
+   ld bc,$7ffd
+   out (c),a                   ; bank in: no stack from here
+   exx
+   ldir                        ; bank -> buffer, hl = next src
+   exx
+   ld a,(BANKM)
+   out (c),a                   ; bank 0 back
+   exx
+   ei
+
+   pop de                      ; dst
+   pop bc                      ; piece
+   push hl                     ; next src
+   push bc
+   ld hl,BANK_BUFFER
+   ldir                        ; buffer -> dst, de = next dst
+   pop bc                      ; piece
+   pop hl                      ; next src
+   ex (sp),hl                  ; hl = len
+   or a
+   sbc hl,bc
+   ld c,l
+   ld b,h                      ; bc = len left
+   pop hl                      ; next src
+   jr copy_loop
+
+
+SECTION bss_user
+
+bank_value:  defs 1            ; port 0x7ffd value with the bank paged in
+
+ENDIF
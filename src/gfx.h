@@ -21,10 +21,28 @@ extern  unsigned char ghost_dead[];
 extern  unsigned char pill[];
 extern  unsigned char pill_flash[];
 
+// the same frames pre-shifted 8 times (tools/preshift.py), PRESHIFT_* builds only
+
+extern  unsigned char munchkin_shifted[];
+extern  unsigned char munchkin_left_shifted[];
+extern  unsigned char munchkin_right_shifted[];
+extern  unsigned char munchkin_center_shifted[];
+extern  unsigned char munchkin_up_shifted[];
+extern  unsigned char munchkin_down_shifted[];
+extern  unsigned char ghost_shifted[];
+extern  unsigned char ghost_dead_shifted[];
+extern  unsigned char pill_shifted[];
+extern  unsigned char pill_flash_shifted[];
+
 // background tile graphics
 
+#ifdef PACKED_MAZES
+extern unsigned char ptiles_packed[];        // tools/packmaze.py
+extern unsigned char ptiles_maze2_packed[];
+#else
 extern unsigned char ptiles[];
 extern unsigned char ptiles_maze2[];
+#endif
 
 #define TILES_BASE 128
 #define TILES_LEN  16
@@ -32,6 +50,29 @@ extern unsigned char ptiles_maze2[];
 extern unsigned char tiles[];
 extern unsigned char tiles_maze2[];
 
+// maze line graphics, redefined per maze in rotate_maze_center()
+
+extern unsigned char udg_line_vert[];
+extern unsigned char udg_line_hori[];
+extern unsigned char udg_top_left[];
+extern unsigned char udg_top_right[];
+extern unsigned char udg_bottom_left[];
+extern unsigned char udg_bottom_right[];
+extern unsigned char udg_line_hori_right[];
+extern unsigned char udg_line_hori_left[];
+extern unsigned char udg_line_vert_bottom[];
+extern unsigned char udg_line_vert_top[];
+extern unsigned char udg_line_hori_left_maze2[];
+extern unsigned char udg_line_vert_top_maze2[];
+extern unsigned char udg_bottom_left_maze2[];
+extern unsigned char udg_top_left_maze2[];
+
+extern unsigned char udg_square_block[];   // menu logo
+
+#ifdef MENU_SCREEN
+extern unsigned char menu[];               // menu logo, zx7 compressed (gfx/menu.asm)
+#endif
+
 #endif
 
 
@@ -17,14 +17,19 @@ IM2_DEFINE_ISR_8080(isr)
    ++tick;
 }
 
-void
+// waits until WFRAMES frames have passed since the last wait(),
+// returns the frames that did pass (more than WFRAMES: late)
+unsigned char
 wait(void)
 {
-   //while (abs(tick - timer) < WFRAMES)
-   while (abs(tick - timer) < 1)
+   unsigned int frames;
+
+   while (tick - timer < WFRAMES)
       intrinsic_halt();
-   
+
+   frames = tick - timer;
    timer = tick;
+   return (frames > 255) ? 255 : frames;
 }
 
 void
@@ -1,8 +1,9 @@
 #ifndef _INT_H
 #define _INT_H
 
+// frames per wait(): 1 = 50 Hz, 2 = 25 Hz (also the game loop in the FRAME_PACING build)
 #ifndef WFRAMES
-#define WFRAMES  4
+#define WFRAMES  1
 #endif
 
 #define clock(x) (tick)
@@ -10,7 +11,7 @@
 extern unsigned int tick;
 extern unsigned int timer;
 
-extern void wait(void);
+extern unsigned char wait(void);
 extern void setup_int(void);
 
 #endif
@@ -1,4 +1,6 @@
 ; 1024 bytes of scratch memory before the program at address 0x5e24
+; (per maze arena for tables derived from the maze, see arena_alloc() in main.c,
+; the 128K build uses the last 256 bytes as the buffer of bank_copy in bank.asm)
 
 PUBLIC _TEMPMEM
 defc   _TEMPMEM = 0x5e24
@@ -43,8 +45,35 @@ asm_malloc:
    ; we have only one queue with one size so that's what we use
    
    ld hl,0                     ; queue #0
+
+IFDEF MEMORY_STATS
+
+   ; debug build: count the blocks in use and remember the peak
+
+   call asm_balloc_alloc
+   ret c                       ; no block left
+
+   push hl
+   ld hl,_blocks_used
+   inc (hl)
+   ld a,(hl)
+   inc hl                      ; hl = _blocks_peak
+   cp (hl)
+   jr c, peak_done
+   ld (hl),a
+
+peak_done:
+
+   pop hl
+   or a                        ; carry reset
+   ret
+
+ELSE
+
    jp asm_balloc_alloc         ; agrees with the library's requirements above
 
+ENDIF
+
 
 PUBLIC asm_free
 
@@ -69,9 +98,35 @@ asm_free:
    ;
    ; uses  : af, de, hl
 
+IFDEF MEMORY_STATS
+
+   ld a,h
+   or l
+   jr z, count_done            ; free(0) does nothing
+   ld a,(_blocks_used)
+   dec a
+   ld (_blocks_used),a
+
+count_done:
+
+ENDIF
+
    push bc
    
    call asm_balloc_free        ; agrees with lib req but the lib does not allow bc to change
    
    pop bc
    ret
+
+
+IFDEF MEMORY_STATS
+
+SECTION bss_user
+
+PUBLIC _blocks_used
+PUBLIC _blocks_peak
+
+_blocks_used:  defs 1          ; sp1 blocks in use
+_blocks_peak:  defs 1          ; most blocks in use at once (must follow _blocks_used)
+
+ENDIF
@@ -18,11 +18,15 @@ Generates munchkin_z80_colour.tap (standalone for use in fuse or real heardware)
 ***********************************************************************************************/
 #include <arch/zx.h>
 #include <stdlib.h>
+#include <stddef.h>
 #include <string.h>
 #include <arch/zx/sp1.h>
 #include <alloc/balloc.h>
 #include <input.h>
 #include <intrinsic.h>
+#ifdef MENU_SCREEN
+#include <compress/zx7.h>
+#endif
 
 #include "gfx.h"
 #include "int.h"
@@ -32,25 +36,68 @@ Generates munchkin_z80_colour.tap (standalone for use in fuse or real heardware)
 // scratch ram at 0x5e24 before program
 extern unsigned char TEMPMEM[1024];   // address placement defined in main.asm
 
+// TEMPMEM is an arena for tables derived from the current maze, handed out by
+// arena_alloc() in start_new_maze() and all given back at the next maze
+
+#ifdef ZX128
+#define ARENA_SIZE            768     // the last 256 bytes are the buffer of bank_copy() (bank.asm)
+#else
+#define ARENA_SIZE           1024
+#endif
+
+unsigned int arena_top;               // bytes of TEMPMEM in use
+
+// a condition the compiler checks, a false one fails the build (array of size -1)
+#define COMPILE_CHECK(name, condition)   typedef char name[(condition) ? 1 : -1]
+
 #define VERSION "0.7"
 
+#ifdef ZX128
+// 128K build: the screen and tiles of the mazes are in ram bank MAZE_BANK
+// (made by tools/mkbank.py, see build.sh) and copied to main ram by
+// load_maze_pack() in start_new_maze(), never while playing
+
+#define MAZE_BANK            1
+#define MAZE_PACKS           ((maze_pack_type *)0xc000)   // directory at the start of the bank
+#define MAZE_PTILES_SIZE   512               // largest maze screen (checked by mkbank.py)
+
+typedef struct {
+  unsigned char bank;                        // ram bank, paged in at 0xc000
+  void *src;                                 // in the bank
+  void *dst;                                 // in bank 0 ram
+  unsigned int len;
+} bank_copy_type;
+
+typedef struct {
+  unsigned char *ptiles;                     // screen, for sp1_PrintString()
+  unsigned int ptiles_len;
+  unsigned char *tiles;                      // TILES_LEN udgs
+} maze_pack_type;
+
+extern void bank_copy(bank_copy_type *copy) __z88dk_fastcall;   // in bank.asm
+
+bank_copy_type bank_copy_args;
+maze_pack_type maze_pack;                    // directory entry of the maze being loaded
+unsigned char maze_ptiles[MAZE_PTILES_SIZE]; // screen of the current maze
+unsigned char maze_tiles[TILES_LEN * 8];     // tiles of the current maze (sp1 points here)
+#endif
+
 
 // list of all beepfx sound effects
 typedef struct effects_s
 {
    void *effect;
-   char *name;
 } effects_t;
  
 const effects_t beepfx[] = {
-    {BEEPFX_PICK,              "BEEPFX_EAT_PILL"},
-    {BEEPFX_HIT_2,             "BEEPFX_EAT_GHOST"},
-    {BEEPFX_GULP,              "BEEPFX_GULP_GHOST"},
-    {BEEPFX_ITEM_3,            "BEEPFX_EAT_POWERPILL"},
-    {BEEPFX_POWER_OFF,         "BEEPFX_DYING"},
-    {BEEPFX_FAT_BEEP_1,        "BEEPFX_DYING_SHORT"},
-    {BEEPFX_JUMP_2,            "BEEPFX_MOVE"},
-    {BEEPFX_ITEM_3,            "BEEPFX_MAZE_COMPLETE"}
+    {BEEPFX_PICK},                 // 0 eat pill
+    {BEEPFX_HIT_2},                // 1 eat ghost
+    {BEEPFX_GULP},                 // 2 gulp ghost
+    {BEEPFX_ITEM_3},               // 3 eat powerpill
+    {BEEPFX_POWER_OFF},            // 4 dying
+    {BEEPFX_FAT_BEEP_1},           // 5 dying short
+    {BEEPFX_JUMP_2},               // 6 move
+    {BEEPFX_ITEM_3}                // 7 maze complete
 };
 
 // convenient globals (runs better in z88dk)
@@ -70,12 +117,111 @@ struct sp1_Rect cr = { 0, 0, 32, 24 };
 //unsigned int saved_tick;
 
 
+// optional: other number of pills, build with -DMAX_PILLS=n (12, 48 with PILL_STORM below;
+// the pills after the first 12 are spread at random)
+#ifndef MAX_PILLS
+#ifdef PILL_STORM
+#define MAX_PILLS            48       // size of pills[], NUM_PILLS may not be higher
+#else
+#define MAX_PILLS            12       // size of pills[], NUM_PILLS may not be higher
+#endif
+#endif
+
 // unsigned char in stead of #define (runs/compiles better in z88dk)
 unsigned char MAZE_OFFSET_X = 16;
 unsigned char MAZE_OFFSET_Y = 32;
-unsigned char NUM_PILLS = 12;            
+unsigned char NUM_PILLS = MAX_PILLS;
 unsigned char NUM_GHOSTS = 4;            
 
+// optional pill storm: build with -DPILL_STORM for 48 pills, drawn by the pill layer
+// (PILL_LAYER below) and moved in PILL_BATCHES groups, one group per frame
+#ifdef PILL_STORM
+#ifndef PILL_LAYER
+#define PILL_LAYER
+#endif
+#define PILL_BATCHES         5        // every pill still moves once per 5 frames
+#else
+#define PILL_BATCHES         1        // one group: all pills together, every 5th frame (see run_play)
+#endif
+
+#define MAX_GHOSTS           9        // size of ghosts[], NUM_GHOSTS may not be higher
+
+// sp1 memory (balloc queue 0, blocks of 24 bytes + 1 byte overhead)
+// every sprite is one struct sp1_ss (20 bytes) and one struct sp1_cs (24 bytes) per char:
+// 2 columns of 2 chars. Pill sprites are deleted before they are created again, munchkin
+// and ghost sprites when a game ends, so at most all sprites exist at the same time.
+
+#define SPRITE_BLOCKS        (1 + 2 * 2)
+#ifdef PILL_LAYER
+#define SP1_BLOCKS           ((1 + MAX_GHOSTS) * SPRITE_BLOCKS)            // pills are no sprites
+#else
+#define SP1_BLOCKS           ((1 + MAX_GHOSTS + MAX_PILLS) * SPRITE_BLOCKS)
+#endif
+#define SP1_BLOCKS_HIGH      8        // in the unused 208 bytes at 0xd101 (below the im2 jump)
+
+#ifdef MEMORY_STATS
+
+// debug build (-DMEMORY_STATS -Ca-DMEMORY_STATS): deepest stack and most sp1 blocks in use,
+// shown on the menu and kept at 0xd1d4 (free bytes in the sp1 memory map) to read from
+// an emulator memory dump
+
+#define STACK_BOTTOM         0xce00       // 512 bytes stack below REGISTER_SP (zpragma.inc)
+#define STACK_TOP            0xd000
+#define STACK_PAINT          0xa5
+
+typedef struct {
+  unsigned char magic[2];                 // "MS"
+  unsigned int  stack_peak;               // bytes, STACK_TOP - STACK_BOTTOM = stack overflow
+  unsigned char blocks_peak;              // sp1 blocks in use at once
+  unsigned char blocks_low;               // free blocks left at that moment
+} memory_stats_type;
+
+#define memory_stats         (*(memory_stats_type *)0xd1d4)
+
+extern unsigned char blocks_used;         // counted by asm_malloc / asm_free in main.asm
+extern unsigned char blocks_peak;
+
+#endif
+
+// optional chase mode: build with -DGHOST_CHASERS=n to start with n chasing
+// ghosts, one more chases after every completed maze (0 = random ghosts only)
+#ifndef GHOST_CHASERS
+#define GHOST_CHASERS        0
+#endif
+
+#define CHASE_FRAMES       250            // chasers follow the flow field this long,
+#define SCATTER_FRAMES     150            // then roam at random this long
+
+// optional sprite budget: build with -DSPRITE_BUDGET=n to redraw at most about n sprite
+// chars per frame (SPRITE_CHARS per sprite drawn). The munchkin and the ghosts that can
+// be hit are always drawn, what is left goes to the pills and the eaten and recharging
+// ghosts in turns: one that does not fit stays where it is until a later frame, so the
+// game does not slow down with more sprites (0 = no limit). Leave room for the others:
+// n above SPRITE_CHARS * (1 + NUM_GHOSTS), the pills are not drawn at all otherwise.
+#ifndef SPRITE_BUDGET
+#define SPRITE_BUDGET        0
+#endif
+
+#define SPRITE_CHARS         4        // 2 x 2 chars
+
+// optional beam racing: build with -DBEAM_RACING to draw the screen in two bands after the
+// interrupt, first the top rows (the beam is still in the top border) and then the bottom
+// rows (still ahead of the beam), in stead of in the order the sprites happened to move.
+// The sprite moves of a game step are kept in sprite_moves[] until update_bands().
+#ifdef BEAM_RACING
+#define BAND_SPLIT           96       // first pixel row of the bottom band (char row 12)
+#endif
+
+// optional flee mode: build with -DPILL_FLEE=1 to let pills run away from the
+// munchkin, the chance per junction comes from pill_flee_levels[] below
+#ifndef PILL_FLEE
+#define PILL_FLEE            0
+#endif
+
+// chance (out of 10) that a pill flees at a junction, per completed maze
+// (the last entry is used for all further mazes)
+const unsigned char pill_flee_levels[] = { 3, 5, 6, 7, 8, 9 };
+
 #define VERT_LINE_SIZE      18
 #define HORI_LINE_SIZE      26
 #define NUM_HORI_CELLS       9
@@ -93,7 +239,7 @@ unsigned int keys[4] = { 'o', 'p', 'q', 'a' };   //default left, right, up, down
 JOYFUNC joyfunc;
 udk_t   joy_k;
 
-char *redefine_texts[5] = {
+char * const redefine_texts[4] = {
    "\x14\x45" " LEFT:",
    "RIGHT:",
    "   UP:",
@@ -102,28 +248,11 @@ char *redefine_texts[5] = {
 
 // game variables
 // (yes globals because of performance and z88dk!)
-unsigned int  score, high_score;
+// (the state of a game in progress is in game, see game_state_type below)
+unsigned int  high_score;
 
 
-// global variables for use in function rotate_maze_center()
-// (needed this way, because compiler does not handle these as locals very well)
-
-unsigned char udg_line_vert[8]            = {0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18};
-unsigned char udg_line_hori[8]            = {0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00};
-unsigned char udg_top_left[8]             = {0x00,0x00,0x00,0x1F,0x1F,0x18,0x18,0x18};
-unsigned char udg_top_right[8]            = {0x00,0x00,0x00,0xF8,0xF8,0x18,0x18,0x18};
-unsigned char udg_bottom_left[8]          = {0x18,0x18,0x18,0x1F,0x1F,0x00,0x00,0x00};
-unsigned char udg_bottom_right[8]         = {0x18,0x18,0x18,0xF8,0xF8,0x00,0x00,0x00};
-unsigned char udg_line_hori_right[8]      = {0x00,0x00,0x00,0x1F,0x1F,0x00,0x00,0x00};
-unsigned char udg_line_hori_left[8]       = {0x00,0x00,0x00,0xF8,0xF8,0x00,0x00,0x00};
-unsigned char udg_line_vert_bottom[8]     = {0x18,0x18,0x18,0x18,0x18,0x00,0x00,0x00};
-unsigned char udg_line_vert_top[8]        = {0x00,0x00,0x00,0x18,0x18,0x18,0x18,0x18};
-unsigned char udg_line_hori_left_maze2[8] = {0x18,0x18,0x18,0xFF,0xFF,0x00,0x00,0x00};
-unsigned char udg_line_vert_top_maze2[8]  = {0x18,0x18,0x18,0xF8,0xF8,0x18,0x18,0x18};
-unsigned char udg_bottom_left_maze2[8]    = {0x18,0x18,0x18,0x1F,0x1F,0x18,0x18,0x18};
-unsigned char udg_top_left_maze2[8]       = {0x18,0x18,0x18,0xFF,0xFF,0x18,0x18,0x18};
-
-unsigned char udg_square_block[8]         = {0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF};
+// graphics for function rotate_maze_center(): udg_* in gfx/udg.asm (rodata)
 
 #define LEFT                 1
 #define RIGHT                2
@@ -133,46 +262,67 @@ unsigned char udg_square_block[8]         = {0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
 #define FALSE                0
 #define TRUE                 1
 
-unsigned char munchkin_x_factor1;
-unsigned char munchkin_y_factor1;
-unsigned char munchkin_auto_direction;        // if <> 0, then 1,2,3 or 4 for auto movement to cell
-                                              //          1=left, 2=right, 3=up, 4-down
-unsigned char munchkin_last_direction;        // (0=stopped, 1 left, 2 right, 3 up, 4 down)
-unsigned char speed;                          // munchkin speed in pixels per frame
-unsigned char munchkin_animation_frame;       // to display animations during movement
-unsigned char munchkin_dying;                 // TRUE/FALSE
-unsigned char munchkin_dying_animation;       // to display dying animations
-unsigned char maze_completed;                 // TRUE/FALSE  1=completed
-unsigned char maze_completed_animations;      // counter for end of level animations
-unsigned char maze_center_open;               // 1=left, 2=right, 3=up, 4=down
-unsigned char maze_color;                     // 3=magenta, 6=yellow
-unsigned char maze_selected;                  // active maze: 1 or 2
+// junction graph (rebuilt in start_new_maze)
+// cells are numbered row by row: cell = cell_y * NUM_HORI_CELLS + cell_x
+
+#define NUM_CELLS           (NUM_HORI_CELLS * NUM_VERT_CELLS)
+
+#define EXIT_LEFT            0x01
+#define EXIT_RIGHT           0x02
+#define EXIT_UP              0x04
+#define EXIT_DOWN            0x08
+#define CELL_NODE            0x80     // decision cell: junction, bend, dead end or next to the center
+
+#define WRAP_WIDTH           236      // ghosts and pills wrap from x < 8 to x + 236 (and back)
+#define TUNNEL_LENGTH        44       // pixels from cell 0 to cell 8 through the wrap: 28 + 236 - 220
+
+const unsigned char exit_bit[5] = { 0, EXIT_LEFT, EXIT_RIGHT, EXIT_UP, EXIT_DOWN };
+
+unsigned char (*maze_exits)[NUM_CELLS];   // [4] open exits + CELL_NODE per center rotation (maze_center_open - 1)
+unsigned char (*maze_run)[4];             // [NUM_CELLS] pixels to the next node per direction (LEFT - 1 .. DOWN - 1)
+
+const unsigned char reverse_direction[5] = { 0, RIGHT, LEFT, DOWN, UP };
+
+// flow field: steps from every cell to the munchkin's cell (breadth first search)
+// rebuilt when the munchkin changes cell or the center rotates, a few cells per frame
+
+#define FLOW_UNSET           0xff     // cell not reached (yet)
+#define FLOW_CELLS_PER_FRAME 8
+
+unsigned char *flow_dist;                 // [NUM_CELLS] distance per cell
+unsigned char *flow_queue;                // [NUM_CELLS] cells still to expand
+
+unsigned char flow_target;                // cell the field points to (FLOW_UNSET = restart)
+unsigned char flow_head, flow_tail;       // work queue positions
+
+// the tables start_new_maze() takes from the arena: maze_exits, maze_run, flow_dist and flow_queue
+#define ARENA_USED           (4 * NUM_CELLS + NUM_CELLS * 4 + NUM_CELLS + NUM_CELLS)   // 630 bytes
+COMPILE_CHECK(arena_fits, ARENA_USED <= ARENA_SIZE);
 
 unsigned char text_hori_line[NUM_HORI_CELLS + 1];        // + 1 for end of string
 unsigned char text_vert_line[NUM_VERT_LINES_ROW + 1];    // + 1 for end of string
 
-unsigned char last_pill_speed_increased;  // has the speed of the last pill already increased? TRUE/FALSE
-unsigned char powerpill_active_timer;     // timer for how long ghosts are magenta (can be eaten)
-unsigned char active_pills;               
+unsigned int startup_frames;              // frames spent in setup() after setup_int() (x 69888 T-states)
 
-int frame = 1;
+#ifdef FRAME_STATS
+// debug build (-DFRAME_STATS): steps of the last game by the frames they took (tick from one
+// pass of the main loop to the next): 1, 2, 3, 4 or more; shown on the menu
+unsigned int frame_stats[4];
+unsigned int frame_stats_tick;
+#endif
 
 typedef struct horizontal_line_type {     // contains 8 rows of 9 lines
   char line[NUM_HORI_CELLS + 1];
 } horizontal_line_type;
 
-horizontal_line_type horizontal_lines[NUM_HORI_LINES_COL];
-
 typedef struct vertical_line_type {     // contains 8 rows of 9 lines
   char line[NUM_VERT_LINES_ROW + 1];
 } vertical_line_type;
 
-vertical_line_type vertical_lines[NUM_VERT_CELLS];
-
 struct sp1_ss  *munchkin_sprite;
 
 // structure for munchkin animations
-struct {  unsigned char *graphic; }     // sprites in gfx.h
+const struct {  unsigned char *graphic; }     // sprites in gfx.h
 munchkin_sprite_graphic[] = {
   {munchkin},   
   {munchkin_left},
@@ -189,30 +339,220 @@ munchkin_sprite_graphic[] = {
   {munchkin_dying5}
 };
 
+// animation sequences: a frame (an image number) is shown for a number of steps and can
+// start a beepfx[] sound; a sequence ends in ANIM_LOOP (with the frame to go back to in
+// place of the sound) or ANIM_HOLD. anim_step() plays
+// one step of any sequence at the same cost, the munchkin, the ghosts and the maze
+// completed celebration all use it. The ANIM_* flags of the munchkin frames tell run_play()
+// what happens to the ghosts and the game while the frame is shown
+
+#define ANIM_LOOP            0xfe     // end: back to frame .sound
+#define ANIM_HOLD            0xff     // end: stay on the last frame
+#define NO_SOUND             0xff
+
+#define IMAGE_WALK           0xfd     // munchkin: the frame of munchkin_walk
+#define IMAGE_DIRECTION      0xfe     // munchkin: the image of the direction it moves in
+#define IMAGE_HIDDEN         0xff     // munchkin: off the screen
+
+// munchkin images (munchkin_sprite_graphic[])
+#define MUNCHKIN_STOPPED     0
+#define MUNCHKIN_LEFT        1
+#define MUNCHKIN_RIGHT       2
+#define MUNCHKIN_CENTER      3        // mouth closed while moving
+#define MUNCHKIN_UP          4
+#define MUNCHKIN_DOWN        5
+#define MUNCHKIN_CLOSED      6
+#define MUNCHKIN_WIN         7        // mouth open
+#define MUNCHKIN_DYING1      8        // up to MUNCHKIN_DYING5
+#define MUNCHKIN_DYING2      9
+#define MUNCHKIN_DYING3      10
+#define MUNCHKIN_DYING4      11
+#define MUNCHKIN_DYING5      12
+
+// flags of a munchkin frame
+#define ANIM_STOP_GHOSTS     0x01     // the ghosts stand still
+#define ANIM_NO_GHOSTS       0x02     // the ghosts are not drawn and claim no colour
+#define ANIM_HIDE_GHOSTS     0x04     // the ghosts are moved off the screen
+#define ANIM_NEW_GAME        0x08     // a new game starts
+
+typedef struct {
+  unsigned char image;                 // ANIM_LOOP or ANIM_HOLD at the end
+  unsigned char steps;                 // shown for, 0 at the end
+  unsigned char sound;                 // beepfx[] started with the frame, or NO_SOUND (ANIM_LOOP: frame)
+  unsigned char flags;                 // ANIM_* above, 0 for the ghosts
+} anim_frame_type;
+
+typedef struct {
+  const anim_frame_type *sequence;
+  const anim_frame_type *frame;        // shown now
+  unsigned char steps;                 // left of this frame, 0 when holding the last one
+} anim_type;
+
+// munchkin moving: mouth closed 3 steps, then 3 steps the image of its direction
+const anim_frame_type munchkin_walk_anim[] = {
+  { MUNCHKIN_CENTER, 3, NO_SOUND, 0 },
+  { IMAGE_DIRECTION, 3, NO_SOUND, 0 },
+  { ANIM_LOOP,       0, 0,        0 }
+};
+
+const unsigned char munchkin_direction_image[] = {    // stopped, LEFT, RIGHT, UP, DOWN
+  MUNCHKIN_STOPPED, MUNCHKIN_LEFT, MUNCHKIN_RIGHT, MUNCHKIN_UP, MUNCHKIN_DOWN
+};
+
+const anim_frame_type munchkin_alive_anim[] = {
+  { IMAGE_WALK,      1, NO_SOUND, 0 },
+  { ANIM_HOLD,       0, 0,        0 }
+};
+
+// one frame per 10 steps: the ghosts stop, are gone from the third frame on and a new
+// game starts 6 frames after the munchkin is hidden
+const anim_frame_type munchkin_dying_anim[] = {
+  { IMAGE_WALK,      1, NO_SOUND, ANIM_STOP_GHOSTS },
+  { MUNCHKIN_WIN,    1, NO_SOUND, ANIM_STOP_GHOSTS },
+  { MUNCHKIN_CLOSED, 1, 5,        ANIM_STOP_GHOSTS | ANIM_NO_GHOSTS | ANIM_HIDE_GHOSTS },  // dying short
+  { MUNCHKIN_DYING1, 1, NO_SOUND, ANIM_STOP_GHOSTS | ANIM_NO_GHOSTS },
+  { MUNCHKIN_DYING2, 1, NO_SOUND, ANIM_STOP_GHOSTS | ANIM_NO_GHOSTS },
+  { MUNCHKIN_DYING3, 1, 4,        ANIM_STOP_GHOSTS | ANIM_NO_GHOSTS },  // dying
+  { MUNCHKIN_DYING4, 1, NO_SOUND, ANIM_STOP_GHOSTS | ANIM_NO_GHOSTS },
+  { MUNCHKIN_DYING5, 1, NO_SOUND, ANIM_STOP_GHOSTS | ANIM_NO_GHOSTS },
+  { IMAGE_HIDDEN,    6, NO_SOUND, ANIM_STOP_GHOSTS | ANIM_NO_GHOSTS },
+  { IMAGE_HIDDEN,    1, NO_SOUND, ANIM_STOP_GHOSTS | ANIM_NO_GHOSTS | ANIM_NEW_GAME },
+  { ANIM_HOLD,       0, 0,        0 }
+};
+
+// maze completed: magenta maze with the mouth open, yellow with it closed
+const anim_frame_type munchkin_completed_anim[] = {
+  { MUNCHKIN_CLOSED, 2, 7,        0 },    // maze complete
+  { MUNCHKIN_WIN,    3, 7,        0 },
+  { MUNCHKIN_CLOSED, 3, 7,        0 },
+  { ANIM_LOOP,       0, 1,        0 }
+};
+
+// pre-shifted frames (-DPRESHIFT_MUNCHKIN, -DPRESHIFT_GHOSTS, -DPRESHIFT_PILLS, each also
+// with -Ca-D): the 8 shifts of a frame are in gfx/*_shifted.asm (tools/preshift.py) and
+// drawn with SP1_DRAW_MASK2NR, without the rotation tables, for 512 bytes per frame
+
+#define PRESHIFT_COLUMN      32       // bytes from the left to the right column of a shift
+#define PRESHIFT_STRIDE      64       // bytes per shift
+
+#define shifted_frame(shifted, x)    ((shifted) + ((x) & 7) * PRESHIFT_STRIDE)
+
+#ifdef PRESHIFT_MUNCHKIN
+
+#define MUNCHKIN_SHIFTED     MUNCHKIN_CLOSED   // the moving images before it, the others are shifted when drawn
+
+const struct {  unsigned char *shifted; }
+munchkin_shifted_graphic[MUNCHKIN_SHIFTED] = {
+  {munchkin_shifted},
+  {munchkin_left_shifted},
+  {munchkin_right_shifted},
+  {munchkin_center_shifted},
+  {munchkin_up_shifted},
+  {munchkin_down_shifted}
+};
+
+// one shift of the other images, laid out like a shift in gfx/*_shifted.asm:
+// 7 blank rows, left column, 8 blank rows, right column, 8 blank rows
+unsigned char munchkin_shift_buffer[(7 + 8 + 8 + 8 + 8) * 2];
+unsigned char munchkin_shift_image = 0xff;      // image and shift in the buffer
+unsigned char munchkin_shift_x;
+
+#endif
+
 // ghosts
 typedef struct 
 {
   struct sp1_ss *sprite;
-  unsigned char x, y, status,          // status:  1 = normal, 2 = magenta (can be eaten)
-                                       //          3 = eaten/dead, 4 = recharging in center
+  unsigned char x, y, status,          // status:  GHOST_NORMAL, GHOST_FRIGHTENED (magenta, can be eaten)
+                                       //          GHOST_EATEN, GHOST_RECHARGING (in center)
                 colour,                //colour  1=yellow, 2=green, 3=red, 4=cyan (normal)
                                        //        5=magenta                  (can be eaten)
                                        //        7=white                    (dead)
                 direction,             // LEFT,RIGHT, UP, DOWN
                 speed,
-                gulp_sound_delay;      // timer for gulp sound delay
-  int           recharge_timer;        // timer for ghost being recharged
+                countdown,             // pixels left to the next node (0 = choose direction)
+                gulp_sound_delay,      // timer for gulp sound delay
+                timer;                 // frames left in a timed state (recharging), 0 = no timer
 } ghost_sprite;
 
-ghost_sprite ghosts[9];   // max 9
+// ghost state machine: every ghost behaviour is a column in ghost_states[]
+
+#define GHOST_NORMAL         1
+#define GHOST_FRIGHTENED     2     // powerpill eaten: magenta, can be eaten
+#define GHOST_EATEN          3     // white, on its way to the center
+#define GHOST_RECHARGING     4     // white, waiting in the center
+
+#define FRAMES_NORMAL        0     // index in ghost_frame[] (images chosen once per frame)
+#define FRAMES_POWERPILL     1     // blinks when the powerpill is almost over
+#define FRAMES_DEAD          2     // mostly invisible, flashes 3 out of 16 frames
+
+#define MOVE_ROAM            0     // random or chasing at every node
+#define MOVE_HOME            1     // back to the center
+#define MOVE_WAIT            2     // stand still
+
+#define HIT_NONE             0     // passes through the munchkin
+#define HIT_KILLS            1     // munchkin dies
+#define HIT_EATEN            2     // ghost is eaten, goes to state on_hit
+
+typedef struct {
+  unsigned char frames;            // FRAMES_*
+  unsigned char ink;               // 0 = the ghost's own colour
+  unsigned char speed;             // pixels per move (same as the munchkin)
+  unsigned char move;              // MOVE_*
+  unsigned char hit;               // HIT_*
+  unsigned char timer;             // frames before going to next (0 = no timer)
+  unsigned char next;              // after the timer, the powerpill or reaching the center
+  unsigned char on_powerpill;      // when a powerpill is eaten (0 = not affected)
+  unsigned char on_hit;            // after HIT_EATEN
+} ghost_state_type;
+
+const ghost_state_type ghost_states[] = {
+//  frames            ink                        speed  move       hit        timer  next              on_powerpill      on_hit
+  { FRAMES_NORMAL,    0,                         0,     MOVE_WAIT, HIT_NONE,  0,     0,                0,                0           },
+  { FRAMES_NORMAL,    0,                         2,     MOVE_ROAM, HIT_KILLS, 0,     GHOST_NORMAL,     GHOST_FRIGHTENED, 0           },  // GHOST_NORMAL
+  { FRAMES_POWERPILL, INK_MAGENTA | PAPER_BLACK, 2,     MOVE_ROAM, HIT_EATEN, 0,     GHOST_NORMAL,     GHOST_FRIGHTENED, GHOST_EATEN },  // GHOST_FRIGHTENED
+  { FRAMES_DEAD,      INK_WHITE | PAPER_BLACK,   2,     MOVE_HOME, HIT_NONE,  0,     GHOST_RECHARGING, 0,                0           },  // GHOST_EATEN
+  { FRAMES_DEAD,      INK_WHITE | PAPER_BLACK,   2,     MOVE_WAIT, HIT_NONE,  150,   GHOST_NORMAL,     0,                0           }   // GHOST_RECHARGING
+};
+
+unsigned char ghost_frame[3];     // image per FRAMES_* for the current frame
+
+// ghost images per FRAMES_*, in ghost_anims[]
+const anim_frame_type ghost_steady_anim[] = {
+  { 0,         1,  NO_SOUND, 0 },
+  { ANIM_HOLD, 0,  0,        0 }
+};
+const anim_frame_type ghost_blink_anim[] = {       // powerpill almost over
+  { 1,         3,  NO_SOUND, 0 },
+  { 0,         1,  NO_SOUND, 0 },
+  { ANIM_LOOP, 0,  0,        0 }
+};
+const anim_frame_type ghost_dead_anim[] = {        // visible 3 out of 16 steps
+  { 0,         3,  NO_SOUND, 0 },
+  { 1,         13, NO_SOUND, 0 },
+  { ANIM_LOOP, 0,  0,        0 }
+};
+
+anim_type ghost_anims[3];
 
 // structure for ghost animations
-struct {  unsigned char *graphic; }     // sprites in gfx.h
+const struct {  unsigned char *graphic; }     // sprites in gfx.h
 ghost_sprite_graphic[] = {
   {ghost},   
   {ghost_dead}
 };
 
+#ifdef PRESHIFT_GHOSTS
+const struct {  unsigned char *shifted; }
+ghost_shifted_graphic[] = {
+  {ghost_shifted},
+  {ghost_dead_shifted}
+};
+#define ghost_graphic(n, x)    shifted_frame(ghost_shifted_graphic[n].shifted, x)
+#else
+#define ghost_graphic(n, x)    (ghost_sprite_graphic[n].graphic)
+#endif
+
 
 // pills
 typedef struct 
@@ -222,27 +562,214 @@ typedef struct
                 status,                // status: 0=off, 1=active, 2=powerpill
                 colour_masked,         // TRUE/FALSE  ; if TRUE then colour is changed
                                        //               to prevent colour clash with ghost
-                direction, speed;   
+                direction, speed,
+                countdown;             // pixels left to the next node (0 = choose direction)
 } pill_sprite;
 
-pill_sprite pills[12];    // max 12
-
-struct {  unsigned char *graphic; }     // sprites in gfx.h
+// first part of ghost_sprite and pill_sprite: everything move_actor() needs
+// (same field order in both, the assembly kernels in move.asm use these offsets)
+typedef struct
+{
+  struct sp1_ss *sprite;              // +0
+  unsigned char x, y,                 // +2, +3
+                status,               // +4
+                colour,               // +5  (pill: colour_masked)
+                direction,            // +6
+                speed,                // +7
+                countdown;            // +8
+} actor_type;
+
+const struct {  unsigned char *graphic; }     // sprites in gfx.h
 pill_sprite_graphic[] = {
   {pill},   
   {pill_flash}
 };
 
+#ifdef PRESHIFT_PILLS
+const struct {  unsigned char *shifted; }
+pill_shifted_graphic[] = {
+  {pill_shifted},
+  {pill_flash_shifted}
+};
+#define pill_graphic(n, x)     shifted_frame(pill_shifted_graphic[n].shifted, x)
+#else
+#define pill_graphic(n, x)     (pill_sprite_graphic[n].graphic)
+#endif
+
+#define PILL_OFF             0xff     // pill_image() of a pill that is not drawn
+
+#ifdef PILL_LAYER
+
+// optional pill layer: build with -DPILL_LAYER to draw the pills in the background
+// tiles instead of with sp1 sprites (no sp1 blocks, no masked sprite draw). Every cell
+// with a pill gets a copy of its tile with the pills in it. Only the pills that moved
+// or changed leave their cells and enter their new ones, and only those cells are
+// composed again (from the tile, with all pills in them). A cell gets its tile and
+// colour back when the last pill leaves. PRESHIFT_PILLS is not used then.
+
+#define PILL_CHARS           4        // a pill covers at most 2 x 2 cells
+#define PILL_CELLS           (MAX_PILLS * PILL_CHARS)   // every pill in cells of its own
+#define SP1_TILE_ARRAY       ((unsigned char *)0xf000)   // sp1 tile graphics: 256 low, 256 high bytes
+
+typedef struct {
+  unsigned char graphic[8];            // the tile with the pills in it (first: the cell's
+                                       // tile points at its pill_cell_type)
+  struct sp1_update *update;           // the cell
+  unsigned int tile;                   // its own tile and colour, put back when the last pill leaves
+  unsigned char colour;
+  unsigned char pills;                 // pills in it (0: free)
+  unsigned char compose;               // TRUE: in compose_cells[]
+} pill_cell_type;
+
+pill_cell_type pill_cells[PILL_CELLS];
+unsigned char free_cells[PILL_CELLS];          // pill_cells[] not in use
+unsigned char num_free_cells;
+pill_cell_type *compose_cells[PILL_CELLS];     // cells to compose again in this draw_pills()
+unsigned char num_compose_cells;
+
+struct {
+  unsigned char x, y, image;           // as drawn now
+  unsigned char ink;                   // set by set_pill_ink()
+  unsigned char dirty;                 // TRUE: leaves its cells at the next draw_pills()
+  pill_cell_type *cells[PILL_CHARS];   // the cells it is in (NULL: no more)
+} pill_layer[MAX_PILLS];
+
+COMPILE_CHECK(pill_cells_fit, PILL_CELLS <= 255);    // unsigned char indexes
+
+#endif
+
+#if SPRITE_BUDGET
+int sprite_budget;                     // chars left in this frame (below 0: over budget)
+unsigned char ghost_turn;              // first of the low priority sprites to draw
+unsigned char pill_turn;
+#ifndef PILL_LAYER
+struct {
+  unsigned char x, y, image;           // as drawn now, not drawn again if the same
+} pill_drawn[MAX_PILLS];
+#endif
+#else
+#define pill_turn            0
+#endif
+
+#ifdef BEAM_RACING
+typedef struct {
+  struct sp1_ss *sprite;
+  unsigned char *frame;
+  unsigned char x, y;
+} sprite_move_type;
+
+sprite_move_type sprite_moves[1 + MAX_GHOSTS + MAX_PILLS];   // every sprite once per step
+unsigned char num_sprite_moves;
+#endif
+
+// colour clash: a char cell shows the ink of the sprite in front, munchkin > ghost > pill.
+// resolve_colours() runs once per step after the moves: the munchkin and the visible ghosts
+// claim their cells (in that order), then every sprite char takes the ink of the first
+// claim on its cell (or its own ink) and only the chars whose ink changes are written
+#define MAX_CLAIMS           (SPRITE_CHARS * (1 + MAX_GHOSTS))
+#define MUNCHKIN_INK         INK_CYAN
+
+typedef struct {
+  unsigned int cell;                   // row * 32 + column
+  unsigned char ink;
+} claim_type;
+
+claim_type claims[MAX_CLAIMS];         // munchkin first, then the visible ghosts
+unsigned char num_claims;
+unsigned char claimed[32 * 24 / 8];    // one bit per cell with a claim
+unsigned char sprite_char_offset[SPRITE_CHARS] = { 0, 32, 1, 33 };   // cells in the order of sp1_IterateSprChar()
+unsigned int resolve_cell;             // top left cell of the sprite in resolve_char()
+unsigned char resolve_masked;          // a char of it did not get its own ink
+
+unsigned char pill_first = 0;          // pills handled this frame: pill_first, + pill_step, ...
+unsigned char pill_step = 1;           // (set by handle_pills(), see PILL_BATCHES)
+
+// game state: everything of a game in progress in one block, so that it can
+// be saved and restored with one ldir (save_game() / restore_game()).
+// Not in here: the settings (NUM_GHOSTS, ...), the sprites (pointers are
+// fixed up on restore) and what is rebuilt from it (the flow field and the
+// maze tables in TEMPMEM).
+// Change GAME_STATE_VERSION when the layout changes, the first fields and
+// the maze lines are also used by move.asm (GAME_* offsets there).
+
+#define GAME_STATE_VERSION   2
+
+typedef struct
+{
+  unsigned char version;                      // +0   GAME_STATE_VERSION
+  unsigned char munchkin_x_factor1;           // +1
+  unsigned char munchkin_y_factor1;           // +2
+  unsigned char munchkin_auto_direction;      // +3   if <> 0, then 1,2,3 or 4 for auto movement to cell
+                                              //              1=left, 2=right, 3=up, 4-down
+  unsigned char munchkin_last_direction;      // +4   (0=stopped, 1 left, 2 right, 3 up, 4 down)
+  unsigned char speed;                        // +5   munchkin speed in pixels per frame
+  horizontal_line_type horizontal_lines[NUM_HORI_LINES_COL];   // +6
+  vertical_line_type vertical_lines[NUM_VERT_CELLS];           // +86
+
+  anim_type munchkin_anim;                    // alive, dying or maze completed
+  anim_type munchkin_walk;                    // mouth while moving (IMAGE_WALK)
+  unsigned char munchkin_dying;               // TRUE/FALSE (munchkin_anim is munchkin_dying_anim)
+  unsigned char maze_completed;               // TRUE/FALSE  1=completed
+  unsigned char maze_completed_animations;    // counter for end of level animations
+  unsigned char maze_center_open;             // 1=left, 2=right, 3=up, 4=down
+  unsigned char maze_color;                   // 3=magenta, 6=yellow
+  unsigned char maze_selected;                // active maze: 1 or 2
+  unsigned char mazes_completed;              // in this game
+  unsigned char num_chasers;                  // ghosts that chase the munchkin (first n ghosts)
+  unsigned char ghost_mode_timer;             // frames left in chase (or scatter) phase
+  unsigned char ghosts_chasing;               // TRUE = chase phase, FALSE = scatter phase
+  unsigned char pill_flee;                    // chance for the current maze, 0 = never
+  unsigned char last_pill_speed_increased;    // has the speed of the last pill already increased? TRUE/FALSE
+  unsigned char powerpill_active_timer;       // timer for how long ghosts are magenta (can be eaten)
+  unsigned char active_pills;
+  unsigned int  score;
+  int frame;
+
+  ghost_sprite ghosts[MAX_GHOSTS];
+  pill_sprite pills[MAX_PILLS];
+} game_state_type;
+
+// ghosts and pills are moved as actor_type
+COMPILE_CHECK(ghost_is_actor, offsetof(ghost_sprite, x) == offsetof(actor_type, x) && offsetof(ghost_sprite, y) == offsetof(actor_type, y)
+              && offsetof(ghost_sprite, direction) == offsetof(actor_type, direction) && offsetof(ghost_sprite, speed) == offsetof(actor_type, speed)
+              && offsetof(ghost_sprite, countdown) == offsetof(actor_type, countdown));
+COMPILE_CHECK(pill_is_actor, offsetof(pill_sprite, x) == offsetof(actor_type, x) && offsetof(pill_sprite, y) == offsetof(actor_type, y)
+              && offsetof(pill_sprite, direction) == offsetof(actor_type, direction) && offsetof(pill_sprite, speed) == offsetof(actor_type, speed)
+              && offsetof(pill_sprite, countdown) == offsetof(actor_type, countdown));
+
+#ifdef ASM_MOVEMENT
+// the defc offsets in move.asm (GAME_* and ACTOR_*)
+COMPILE_CHECK(move_asm_game_munchkin, offsetof(game_state_type, munchkin_x_factor1) == 1 && offsetof(game_state_type, munchkin_y_factor1) == 2
+              && offsetof(game_state_type, munchkin_auto_direction) == 3 && offsetof(game_state_type, munchkin_last_direction) == 4
+              && offsetof(game_state_type, speed) == 5);
+COMPILE_CHECK(move_asm_game_lines, offsetof(game_state_type, horizontal_lines) == 6 && offsetof(game_state_type, vertical_lines) == 86
+              && sizeof(horizontal_line_type) == 10 && sizeof(vertical_line_type) == 11);
+COMPILE_CHECK(move_asm_actor, offsetof(actor_type, x) == sizeof(struct sp1_ss *)    // +2, +3, +6, +7, +8 on the Z80
+              && offsetof(actor_type, y) == offsetof(actor_type, x) + 1 && offsetof(actor_type, direction) == offsetof(actor_type, x) + 4
+              && offsetof(actor_type, speed) == offsetof(actor_type, x) + 5 && offsetof(actor_type, countdown) == offsetof(actor_type, x) + 6);
+#endif
+
+game_state_type game = { GAME_STATE_VERSION };
+
+#ifdef GAME_SNAPSHOT
+game_state_type snapshot;                     // key 1 saves, key 2 restores (testing)
+#endif
+
 #define _________________________a
 #define ___FORWARD_DECLARATIONS__b
 #define _________________________c
 
 void setup_maze(void);
 void add_colour_to_sprite(unsigned int count, struct sp1_cs *c);
+#ifdef PACKED_MAZES
+void unpack_maze(unsigned char *packed, unsigned char attr);
+#endif
+void print_maze(unsigned char attr);
 void handle_maze_completed(void);
 void pad_numbers(unsigned char *s, unsigned int limit, long number);
 void get_ink_colour(unsigned char a_colour);
 void run_redefine_keys(void);
+void clear_screen(unsigned char attr);
 void draw_menu(void);
 void run_intro(void);
 //void update_horde(void);
@@ -251,25 +778,86 @@ void display_score(void);
 //void update_sprites(void);
 //void update_script(void);
 void handle_munchkin(unsigned char munchkin_direction, unsigned char munchkin_manual_move);
+#ifdef ASM_MOVEMENT
+extern void move_munchkin(unsigned char munchkin_direction) __z88dk_fastcall;   // in move.asm
+extern void move_actor(actor_type *actor) __z88dk_fastcall;                     // in move.asm
+#else
+void move_munchkin(unsigned char munchkin_direction);
+void move_actor(actor_type *actor);
+#endif
 void get_user_input(void);
 void run_play(void);
+void anim_start(anim_type *a, const anim_frame_type *sequence);
+void anim_select(anim_type *a, const anim_frame_type *sequence);
+unsigned char anim_step(anim_type *a);
 void draw_munchkin(void);
+unsigned char *munchkin_graphic(unsigned char image_num);
+#ifdef PRESHIFT_MUNCHKIN
+void shift_frame(unsigned char *dst, unsigned char *graphic, unsigned char shift);
+#endif
 void setup_ghosts(void);
+#ifdef BEAM_RACING
+void move_sprite(struct sp1_ss *s, unsigned char *frame, unsigned char x, unsigned char y);
+void update_bands(unsigned char draw);
+#define update_screen()      update_bands(TRUE)
+#else
+#define move_sprite(s, frame, x, y)   sp1_MoveSprPix(s, &cr, frame, x, y)
+#define update_screen()      sp1_UpdateNow()
+#endif
 void draw_ghosts(void);
+void draw_ghost(unsigned char i);
+#if SPRITE_BUDGET
+unsigned char sprite_fits(void);
+#endif
 void handle_ghosts(void);
 void choose_ghost_direction (unsigned char i);
+void set_ghost_state(unsigned char i, unsigned char state);
+void get_ghost_ink(unsigned char i);
 void check_ghosts_hits_munchkin(void);
 void setup_pills(void);
+void create_pill_sprite(unsigned char i);
+void delete_pill_sprite(unsigned char i);
+void set_pill_ink(unsigned char i);
+#ifdef PILL_LAYER
+void setup_pill_layer(void);
+void compose_cell(pill_cell_type *c);
+void leave_pill_cells(unsigned char i);
+pill_cell_type *pill_cell(unsigned char i, unsigned char row, unsigned char col, unsigned char enter);
+void draw_pill_layer(unsigned char i, unsigned char *graphic, unsigned char enter);
+void compose_pill_cells(void);
+#endif
 void draw_pills(void);
+unsigned char pill_image(unsigned char i);
 void check_pill_eaten(void);
 void handle_pills(void);
-void check_pills_mask(void);
+void claim_cells(unsigned char x, unsigned char y, unsigned char ink);
+unsigned char is_claimed(unsigned int cell);
+void resolve_char(unsigned int count, struct sp1_cs *c);
+void resolve_sprite(struct sp1_ss *s, unsigned char x, unsigned char y);
+void resolve_colours(void);
 void choose_pill_direction (unsigned char i);
 void rotate_maze_center(void);
+void set_maze_center_walls(unsigned char center_open);
+void build_maze_graph(void);
+void *arena_alloc(unsigned int size);
+unsigned char edge_length(unsigned char cell, unsigned char direction);
+unsigned char neighbour_cell(unsigned char cell, unsigned char direction);
+void update_flow_field(void);
+unsigned char flow_direction(unsigned char cell, unsigned char exits, unsigned char direction, unsigned char flee);
 void setup(void);
+#ifdef MEMORY_STATS
+void paint_stack(void);
+void update_memory_stats(void);
+#endif
 void start_new_game(void);
 void start_new_maze(void); 
+void setup_maze_tiles(void);
+#ifdef ZX128
+void load_maze_pack(unsigned char maze);
+#endif
 void hide_sprites(void);
+void save_game(game_state_type *s);
+unsigned char restore_game(game_state_type *s);
 int main(void);
 
 #define __________a
@@ -283,38 +871,38 @@ void setup_maze(void)
   //char text_hori_line[NUM_HORI_CELLS + 1];        // + 1 for end of string
   //char text_vert_line[NUM_VERT_LINES_ROW + 1];    // + 1 for end of string
   
-  if (maze_selected == 1) {
-  strcpy(text_hori_line, "xxxxxxxxx");  strcpy(horizontal_lines[0].line, text_hori_line);
-  strcpy(text_vert_line, "|---|----|"); strcpy(vertical_lines[0].line,   text_vert_line);
-  strcpy(text_hori_line, "-x---x-x-");  strcpy(horizontal_lines[1].line, text_hori_line);
-  strcpy(text_vert_line, "|--|-----|"); strcpy(vertical_lines[1].line,   text_vert_line);
-  strcpy(text_hori_line, "----xx---");  strcpy(horizontal_lines[2].line, text_hori_line);
-  strcpy(text_vert_line, "|||--|-|||"); strcpy(vertical_lines[2].line,   text_vert_line);
-  strcpy(text_hori_line, "--x---x--");  strcpy(horizontal_lines[3].line, text_hori_line);
-  strcpy(text_vert_line, "|-|----|-|"); strcpy(vertical_lines[3].line,   text_vert_line);
-  strcpy(text_hori_line, "x---x---x");  strcpy(horizontal_lines[4].line, text_hori_line);
-  strcpy(text_vert_line, "---||||---"); strcpy(vertical_lines[4].line,   text_vert_line);
-  strcpy(text_hori_line, "x-------x");  strcpy(horizontal_lines[5].line, text_hori_line);
-  strcpy(text_vert_line, "|-|----|-|"); strcpy(vertical_lines[5].line,   text_vert_line);
-  strcpy(text_hori_line, "-x--x-xx-");  strcpy(horizontal_lines[6].line, text_hori_line);
-  strcpy(text_vert_line, "|--|-|---|"); strcpy(vertical_lines[6].line,   text_vert_line);
-  strcpy(text_hori_line, "xxxxxxxxx");  strcpy(horizontal_lines[7].line, text_hori_line);
+  if (game.maze_selected == 1) {
+  strcpy(text_hori_line, "xxxxxxxxx");  strcpy(game.horizontal_lines[0].line, text_hori_line);
+  strcpy(text_vert_line, "|---|----|"); strcpy(game.vertical_lines[0].line,   text_vert_line);
+  strcpy(text_hori_line, "-x---x-x-");  strcpy(game.horizontal_lines[1].line, text_hori_line);
+  strcpy(text_vert_line, "|--|-----|"); strcpy(game.vertical_lines[1].line,   text_vert_line);
+  strcpy(text_hori_line, "----xx---");  strcpy(game.horizontal_lines[2].line, text_hori_line);
+  strcpy(text_vert_line, "|||--|-|||"); strcpy(game.vertical_lines[2].line,   text_vert_line);
+  strcpy(text_hori_line, "--x---x--");  strcpy(game.horizontal_lines[3].line, text_hori_line);
+  strcpy(text_vert_line, "|-|----|-|"); strcpy(game.vertical_lines[3].line,   text_vert_line);
+  strcpy(text_hori_line, "x---x---x");  strcpy(game.horizontal_lines[4].line, text_hori_line);
+  strcpy(text_vert_line, "---||||---"); strcpy(game.vertical_lines[4].line,   text_vert_line);
+  strcpy(text_hori_line, "x-------x");  strcpy(game.horizontal_lines[5].line, text_hori_line);
+  strcpy(text_vert_line, "|-|----|-|"); strcpy(game.vertical_lines[5].line,   text_vert_line);
+  strcpy(text_hori_line, "-x--x-xx-");  strcpy(game.horizontal_lines[6].line, text_hori_line);
+  strcpy(text_vert_line, "|--|-|---|"); strcpy(game.vertical_lines[6].line,   text_vert_line);
+  strcpy(text_hori_line, "xxxxxxxxx");  strcpy(game.horizontal_lines[7].line, text_hori_line);
   } else {
-  strcpy(text_hori_line, "xxxxxxxxx");  strcpy(horizontal_lines[0].line, text_hori_line);
-  strcpy(text_vert_line, "||---|---|"); strcpy(vertical_lines[0].line,   text_vert_line);
-  strcpy(text_hori_line, "-xxx--x-x");  strcpy(horizontal_lines[1].line, text_hori_line);
-  strcpy(text_vert_line, "|----|-|-|"); strcpy(vertical_lines[1].line,   text_vert_line);
-  strcpy(text_hori_line, "--x-x----");  strcpy(horizontal_lines[2].line, text_hori_line);
-  strcpy(text_vert_line, "||-|-||-||"); strcpy(vertical_lines[2].line,   text_vert_line);
-  strcpy(text_hori_line, "-x---x---");  strcpy(horizontal_lines[3].line, text_hori_line);
-  strcpy(text_vert_line, "|---||-|-|"); strcpy(vertical_lines[3].line,   text_vert_line);
-  strcpy(text_hori_line, "x-xxx-xxx");  strcpy(horizontal_lines[4].line, text_hori_line);
-  strcpy(text_vert_line, "----|||---"); strcpy(vertical_lines[4].line,   text_vert_line);
-  strcpy(text_hori_line, "xx---x--x");  strcpy(horizontal_lines[5].line, text_hori_line);
-  strcpy(text_vert_line, "|--||--|-|"); strcpy(vertical_lines[5].line,   text_vert_line);
-  strcpy(text_hori_line, "-x---x-x-");  strcpy(horizontal_lines[6].line, text_hori_line);
-  strcpy(text_vert_line, "|---|----|"); strcpy(vertical_lines[6].line,   text_vert_line);
-  strcpy(text_hori_line, "xxxxxxxxx");  strcpy(horizontal_lines[7].line, text_hori_line);
+  strcpy(text_hori_line, "xxxxxxxxx");  strcpy(game.horizontal_lines[0].line, text_hori_line);
+  strcpy(text_vert_line, "||---|---|"); strcpy(game.vertical_lines[0].line,   text_vert_line);
+  strcpy(text_hori_line, "-xxx--x-x");  strcpy(game.horizontal_lines[1].line, text_hori_line);
+  strcpy(text_vert_line, "|----|-|-|"); strcpy(game.vertical_lines[1].line,   text_vert_line);
+  strcpy(text_hori_line, "--x-x----");  strcpy(game.horizontal_lines[2].line, text_hori_line);
+  strcpy(text_vert_line, "||-|-||-||"); strcpy(game.vertical_lines[2].line,   text_vert_line);
+  strcpy(text_hori_line, "-x---x---");  strcpy(game.horizontal_lines[3].line, text_hori_line);
+  strcpy(text_vert_line, "|---||-|-|"); strcpy(game.vertical_lines[3].line,   text_vert_line);
+  strcpy(text_hori_line, "x-xxx-xxx");  strcpy(game.horizontal_lines[4].line, text_hori_line);
+  strcpy(text_vert_line, "----|||---"); strcpy(game.vertical_lines[4].line,   text_vert_line);
+  strcpy(text_hori_line, "xx---x--x");  strcpy(game.horizontal_lines[5].line, text_hori_line);
+  strcpy(text_vert_line, "|--||--|-|"); strcpy(game.vertical_lines[5].line,   text_vert_line);
+  strcpy(text_hori_line, "-x---x-x-");  strcpy(game.horizontal_lines[6].line, text_hori_line);
+  strcpy(text_vert_line, "|---|----|"); strcpy(game.vertical_lines[6].line,   text_vert_line);
+  strcpy(text_hori_line, "xxxxxxxxx");  strcpy(game.horizontal_lines[7].line, text_hori_line);
   }
 } 
 
@@ -328,32 +916,80 @@ void add_colour_to_sprite(unsigned int count, struct sp1_cs *c)
 
 
 
+#ifdef PACKED_MAZES
+// the tiles of a packed maze (see tools/packmaze.py) written straight into the
+// update structs in attr, then the whole screen invalidated at once
+void unpack_maze(unsigned char *packed, unsigned char attr)
+{
+  struct sp1_update *u;
+  unsigned char n, tile, row, col;
+
+  row = 0;
+  col = 0;
+  u = sp1_GetUpdateStruct(0, 0);
+  while ((n = *packed++) != 0) {
+     if (n >= TILES_BASE) {       // one tile
+        tile = n;
+        n = 1;
+     } else {                     // n times the next one
+        tile = *packed++;
+     }
+     do {
+        u->colour = attr;
+        u->tile = tile;
+        ++u;
+        if (++col == 32) {
+           col = 0;
+           if (++row < 24) u = sp1_GetUpdateStruct(row, 0);
+        }
+     } while (--n);
+  }
+  sp1_Invalidate(&cr);
+}
+#endif
+
+
+void print_maze(unsigned char attr)
+{
+#ifdef PACKED_MAZES
+#ifdef ZX128
+  unpack_maze(maze_ptiles, attr);
+#else
+  if (game.maze_selected == 1) unpack_maze(ptiles_packed, attr);
+     else unpack_maze(ptiles_maze2_packed, attr);
+#endif
+#else
+  // the maze strings start with "\x14" and their own colour, skip that and
+  // print in attr (the tile strings are rodata and never changed)
+  ps0.attr = attr;
+  sp1_SetPrintPos(&ps0, 0, 0);
+
+#ifdef ZX128
+  sp1_PrintString(&ps0, maze_ptiles + 2);
+#else
+  if (game.maze_selected == 1) sp1_PrintString(&ps0, ptiles + 2);
+     else sp1_PrintString(&ps0, ptiles_maze2 + 2);
+#endif
+#endif
+}
+
+
 void handle_maze_completed(void)
 {
   // change maze color to yellow and magenta
   // smiling munchkin
-  maze_completed_animations --;
+  game.maze_completed_animations --;
   
-  if (maze_completed_animations % 3 == 0) {
-    if (maze_color == '3' ) {
-         maze_color = '6';   
-         ptiles[1] = 0x46; 
-         ptiles_maze2[1] = 0x46; 
+  if (anim_step(&game.munchkin_anim)) {    // next frame of munchkin_completed_anim (and its sound)
+    if (game.munchkin_anim.frame->image == MUNCHKIN_WIN) {
+         game.maze_color = '3';
+         print_maze(BRIGHT | INK_MAGENTA | PAPER_BLACK);
     } else {
-         maze_color = '3';
-         ptiles[1] = 0x43;  
-         ptiles_maze2[1] = 0x43;  
+         game.maze_color = '6';   
+         print_maze(BRIGHT | INK_YELLOW | PAPER_BLACK);
     }  
 
-    sp1_SetPrintPos(&ps0, 0, 0);
-
-    if (maze_selected == 1) sp1_PrintString(&ps0, ptiles);
-      else sp1_PrintString(&ps0, ptiles_maze2);
-
     display_score();
-
-    if (maze_completed_animations % 3 == 0)
-       bit_beepfx_di(beepfx[7].effect);
   }
 }
 
@@ -442,21 +1078,38 @@ void run_redefine_keys(void)
       wait();
 }
 
+// the one full screen clear for going from menu to game and back: sp1's tiles and
+// colours are reset without invalidating them (sp1_ClearRect) and the display file
+// is cleared straight away, so sp1 does not redraw all 768 cells
+void clear_screen(unsigned char attr)
+{
+   sp1_ClearRect(&cr, attr, 32, SP1_RFLAG_TILE | SP1_RFLAG_COLOUR);
+   memset((void *)0x4000, 0, 6144);
+   memset((void *)0x5800, attr, 768);
+}
+
+
 void draw_menu(void)
 {
    unsigned char buffer[16];
    //struct sp1_Rect r = { 10, 2, 30, 10 };
    struct sp1_Rect r = { 9, 0, 32, 14 };
+#ifdef MENU_SCREEN
+   struct sp1_Rect logo = { 0, 0, 32, 5 };
+#endif
 
    // clear the screen first to avoid attribute artifacts
-   sp1_ClearRectInv(&cr, INK_BLACK | PAPER_BLACK, 32, SP1_RFLAG_TILE | SP1_RFLAG_COLOUR);
-   sp1_UpdateNow();
+   clear_screen(INK_BLACK | PAPER_BLACK);
 
    // this will wait for vsync
    wait();
-   //dzx7_standard(menu, (void *)0x4000);
-   // sp1_Validate(&cr);  // not necessary since there was just an update
-
+#ifdef MENU_SCREEN
+   // the logo pre-rendered (tools/mkmenu.py), straight to the top third of the screen;
+   // validated so the next sp1 update does not draw over it with its cleared cells
+   dzx7_standard(menu, (void *)0x4000);
+   memset((void *)0x5800, INK_RED | PAPER_BLACK, 5 * 32);
+   sp1_Validate(&logo);
+#else
    sp1_TileEntry(':', udg_square_block);
    sp1_SetPrintPos(&ps0, 0, 0);
    sp1_PrintString(&ps0, "\x14\x02" "::::: : : ::: ::: : : :  : : :::"); 
@@ -468,6 +1121,7 @@ void draw_menu(void)
    sp1_PrintString(&ps0, "\x14\x02" ": : : : : : : :   : : : :  : : :"); 
    sp1_SetPrintPos(&ps0, 4, 0);
    sp1_PrintString(&ps0, "\x14\x02" ": : : ::: : : ::: : : :  : : : :"); 
+#endif
 
    sp1_SetPrintPos(&ps0, 9, 5);
    sp1_PrintString(&ps0, "\x14\x47" "BASED ON KC MUNCHKIN FOR");
@@ -491,6 +1145,47 @@ void draw_menu(void)
    sp1_PrintString(&ps0, "\x14\x01" "version");
    sp1_SetPrintPos(&ps0, 23, 19);
    sp1_PrintString(&ps0, VERSION);
+
+#ifdef MEMORY_STATS
+   // stack bytes used and sp1 blocks in use / free at the peak
+   update_memory_stats();
+   sp1_SetPrintPos(&ps0, 22, 0);
+   sp1_PrintString(&ps0, "\x14\x01" "STACK      BLOCKS");
+   buffer[0] = 0x14;
+   buffer[1] = INK_BLUE | PAPER_BLACK;
+   pad_numbers(buffer + 2, 3, memory_stats.stack_peak);
+   sp1_SetPrintPos(&ps0, 22, 6);
+   sp1_PrintString(&ps0, buffer);
+   pad_numbers(buffer + 2, 3, memory_stats.blocks_peak);
+   sp1_SetPrintPos(&ps0, 22, 18);
+   sp1_PrintString(&ps0, buffer);
+   pad_numbers(buffer + 2, 3, memory_stats.blocks_low);
+   sp1_SetPrintPos(&ps0, 22, 22);
+   sp1_PrintString(&ps0, buffer);
+#endif
+
+#ifdef FRAME_STATS
+   // steps of the last game that took 1, 2, 3 and 4 or more frames
+   sp1_SetPrintPos(&ps0, 21, 0);
+   sp1_PrintString(&ps0, "\x14\x01" "1:      2:      3:      4+:");
+   buffer[0] = 0x14;
+   buffer[1] = INK_BLUE | PAPER_BLACK;
+   for (i = 0; i < 4; i++) {
+      pad_numbers(buffer + 2, 5, frame_stats[i]);
+      sp1_SetPrintPos(&ps0, 21, 2 + i * 8 + (i == 3));
+      sp1_PrintString(&ps0, buffer);
+   }
+#endif
+
+#ifdef SHOW_STARTUP
+   // time to menu in T-states (48K frame), build with -DSHOW_STARTUP
+   buffer[0] = 0x14;
+   buffer[1] = INK_BLUE | PAPER_BLACK;
+   pad_numbers(buffer + 2, 8, startup_frames * 69888L);
+   sp1_SetPrintPos(&ps0, 23, 0);
+   sp1_PrintString(&ps0, buffer);
+#endif
+
    sp1_UpdateNow();
 
    in_wait_key();
@@ -529,26 +1224,12 @@ void draw_menu(void)
 
 void run_intro(void)
 {
-   sp1_ClearRectInv(&cr, INK_BLACK | PAPER_BLACK, 32, SP1_RFLAG_TILE | SP1_RFLAG_COLOUR);
-   sp1_UpdateNow();
+   // no clear here, run_play() clears the screen once for the game
 
    // the menu key may be is still pressed
    in_wait_nokey();
 
-   // wait for vsync
-   wait();
-
-   // copy attributes to our temp memory area
-   memcpy(TEMPMEM, (void *)0x5800, 768);
-
-   sp1_ClearRectInv(&cr, INK_BLACK | PAPER_BLACK, 32, SP1_RFLAG_TILE | SP1_RFLAG_COLOUR);
-   sp1_UpdateNow();
-
-
 skip_intro:
-   sp1_ClearRectInv(&cr, INK_BLACK | PAPER_BLACK, 32, SP1_RFLAG_TILE | SP1_RFLAG_COLOUR);
-   sp1_UpdateNow();
-
    // in case a key was pressed to skip the intro
    in_wait_nokey();
 }
@@ -570,7 +1251,7 @@ void display_score(void)
 
    buffer[0] = 0x14;
    buffer[1] = BRIGHT | INK_YELLOW | PAPER_BLACK;
-   pad_numbers(buffer + 2, 4, score);
+   pad_numbers(buffer + 2, 4, game.score);
 
    sp1_SetPrintPos(&ps0, 20, 22);
    sp1_PrintString(&ps0, buffer);
@@ -580,102 +1261,125 @@ void display_score(void)
 
 void handle_munchkin(unsigned char munchkin_direction, unsigned char munchkin_manual_move)
 {
+  // munchkin_direction is only set together with munchkin_manual_move (see get_user_input)
+  move_munchkin(munchkin_direction);
+
+  // play "move" sound
+  if (munchkin_manual_move != 0 || game.munchkin_auto_direction != 0) {
+        if (game.active_pills != 1 && game.frame % 5 == 0) {
+           playfx(FX_MOVE);
+        } else { if (game.active_pills == 1 && game.frame % 3 == 0)   // increase "move" sound when last pill on screen
+                 playfx(FX_MOVE);
+               }
+  }
+}
+
+
+#ifndef ASM_MOVEMENT
+
+// movement kernels in C, build with -DASM_MOVEMENT for the assembly versions in move.asm
+
+void move_munchkin(unsigned char munchkin_direction)
+{
+  unsigned char munchkin_manual_move;
   int cell_x, cell_y;           // integer, because cell_x == -1 when left of port
 
-  cell_x = ( (munchkin_x_factor1) - (12 + MAZE_OFFSET_X) ) / (HORI_LINE_SIZE - 2);  
-  cell_y = ( (munchkin_y_factor1) - ( 8 + MAZE_OFFSET_Y) ) / (VERT_LINE_SIZE - 2);  
+  munchkin_manual_move = (munchkin_direction != 0);
+
+  cell_x = ( (game.munchkin_x_factor1) - (12 + MAZE_OFFSET_X) ) / (HORI_LINE_SIZE - 2);  
+  cell_y = ( (game.munchkin_y_factor1) - ( 8 + MAZE_OFFSET_Y) ) / (VERT_LINE_SIZE - 2);  
 
   if (munchkin_manual_move == 1) {  // left
       switch (munchkin_direction) {
 
         case LEFT: 
-          if (vertical_lines[cell_y].line[cell_x] == '|' && 
-              ((munchkin_x_factor1 - speed) < ((MAZE_OFFSET_X + 12 + (cell_x) * (HORI_LINE_SIZE - 2))))
+          if (game.vertical_lines[cell_y].line[cell_x] == '|' && 
+              ((game.munchkin_x_factor1 - game.speed) < ((MAZE_OFFSET_X + 12 + (cell_x) * (HORI_LINE_SIZE - 2))))
                                             // 7 munchkin offset in cel
               ) {
                    ; // continue left (not at center of cell yet)
            } else { 
-              if ( (munchkin_last_direction == UP || munchkin_last_direction == DOWN) 
+              if ( (game.munchkin_last_direction == UP || game.munchkin_last_direction == DOWN) 
                    && 
                    // (MAZE_OFFSET_Y + MUNCHKIN_OFFSET_Y_) % (VERT_LINE_SIZE - 2) , so 32+8 % 18-2
-                   ( (munchkin_y_factor1 - (40)) % (16) == 0)   ) {  // change direction only if on boundery
-                   munchkin_x_factor1 = munchkin_x_factor1 - speed;
-                   munchkin_auto_direction = LEFT;
-                   munchkin_last_direction = LEFT;
+                   ( (game.munchkin_y_factor1 - (40)) % (16) == 0)   ) {  // change direction only if on boundery
+                   game.munchkin_x_factor1 = game.munchkin_x_factor1 - game.speed;
+                   game.munchkin_auto_direction = LEFT;
+                   game.munchkin_last_direction = LEFT;
                } else { 
-                        if (munchkin_last_direction == LEFT || munchkin_last_direction == RIGHT
-                            || munchkin_last_direction == 0  ) { //  if stationary and not on bounderary
+                        if (game.munchkin_last_direction == LEFT || game.munchkin_last_direction == RIGHT
+                            || game.munchkin_last_direction == 0  ) { //  if stationary and not on bounderary
                                                                  //  than movement allowed to the left 
-                              munchkin_x_factor1 = munchkin_x_factor1 - speed;
-                              munchkin_auto_direction = LEFT;
-                              munchkin_last_direction = LEFT;
+                              game.munchkin_x_factor1 = game.munchkin_x_factor1 - game.speed;
+                              game.munchkin_auto_direction = LEFT;
+                              game.munchkin_last_direction = LEFT;
                           }
                       }   
            }
            // colour: left boundery:  16 - (26-2) + 12 = 16 - 24 + 12 = 4
            // colour: right boundery: 255 - (16 - (26-2) + 12 ) = 255 - 4 = 251
-           if (munchkin_x_factor1 < 4) munchkin_x_factor1 = 252;  // wrap screen left     // -4 + 23 left: 196 + 23 right
+           if (game.munchkin_x_factor1 < 4) game.munchkin_x_factor1 = 252;  // wrap screen left     // -4 + 23 left: 196 + 23 right
         break;
 
         case RIGHT: 
-          if (vertical_lines[cell_y].line[cell_x + 1] == '|' && 
-              (munchkin_x_factor1 + speed) > ((MAZE_OFFSET_X + 12 + ((cell_x) * (HORI_LINE_SIZE - 2))))
+          if (game.vertical_lines[cell_y].line[cell_x + 1] == '|' && 
+              (game.munchkin_x_factor1 + game.speed) > ((MAZE_OFFSET_X + 12 + ((cell_x) * (HORI_LINE_SIZE - 2))))
                                          // 7 munchkin offset in cel
               ) { ;  // continue right (not at center of cell yet)
            } else {
-              if ( (munchkin_last_direction == UP || munchkin_last_direction == DOWN) 
+              if ( (game.munchkin_last_direction == UP || game.munchkin_last_direction == DOWN) 
                    && 
-                   ( (munchkin_y_factor1 - (40)) % (16) == 0)   ) {  // change direction only if on boundery
-                   munchkin_x_factor1 = munchkin_x_factor1 + speed;
-                   munchkin_auto_direction = RIGHT;
-                   munchkin_last_direction = RIGHT;
+                   ( (game.munchkin_y_factor1 - (40)) % (16) == 0)   ) {  // change direction only if on boundery
+                   game.munchkin_x_factor1 = game.munchkin_x_factor1 + game.speed;
+                   game.munchkin_auto_direction = RIGHT;
+                   game.munchkin_last_direction = RIGHT;
                } else { ;
-                        if (munchkin_last_direction == LEFT || munchkin_last_direction == RIGHT
-                            || munchkin_last_direction == 0  ) { //  than movement allowed
-                              munchkin_x_factor1 = munchkin_x_factor1 + speed;
-                              munchkin_auto_direction = RIGHT;
-                              munchkin_last_direction = RIGHT;
+                        if (game.munchkin_last_direction == LEFT || game.munchkin_last_direction == RIGHT
+                            || game.munchkin_last_direction == 0  ) { //  than movement allowed
+                              game.munchkin_x_factor1 = game.munchkin_x_factor1 + game.speed;
+                              game.munchkin_auto_direction = RIGHT;
+                              game.munchkin_last_direction = RIGHT;
                           }
                       }   
            }
-           if (munchkin_x_factor1 > 252) munchkin_x_factor1 = 4;  // wrap screen right    // -4 + 23 left: 196 + 23 right
+           if (game.munchkin_x_factor1 > 252) game.munchkin_x_factor1 = 4;  // wrap screen right    // -4 + 23 left: 196 + 23 right
         break;
 
         case UP:  
-          if (horizontal_lines[cell_y].line[cell_x] == 'x' && 
+          if (game.horizontal_lines[cell_y].line[cell_x] == 'x' && 
               //(munchkin_y_factor1 - speed) < ((MAZE_OFFSET_Y + 4 + ((cell_y) * (VERT_LINE_SIZE - 2))))
-              (munchkin_y_factor1 - speed) < ((MAZE_OFFSET_Y + 8 + ((cell_y) * (VERT_LINE_SIZE - 2))))
+              (game.munchkin_y_factor1 - game.speed) < ((MAZE_OFFSET_Y + 8 + ((cell_y) * (VERT_LINE_SIZE - 2))))
                                          // 8 munchkin offset in cel  
               ) {
                  ;
            } else { 
               //if ( (cell_x == -1 && cell_y == 4) || (cell_x == 9 && cell_y == 4) ) {
-              if ( (munchkin_x_factor1 == 4 && cell_y == 4) || (cell_x == 9 && cell_y == 4) ) { // cell_x == -1 not for unsigned char
+              if ( (game.munchkin_x_factor1 == 4 && cell_y == 4) || (cell_x == 9 && cell_y == 4) ) { // cell_x == -1 not for unsigned char
                  ;   // if munchkin outside maze (wrap via tunnel) do not allow UP
               } else {
-                 munchkin_y_factor1 = munchkin_y_factor1 - speed;
-                 munchkin_auto_direction = UP;
-                 munchkin_last_direction = UP;
+                 game.munchkin_y_factor1 = game.munchkin_y_factor1 - game.speed;
+                 game.munchkin_auto_direction = UP;
+                 game.munchkin_last_direction = UP;
               }   
 
            }
         break;
 
         case DOWN: 
-          if (horizontal_lines[cell_y + 1].line[cell_x] == 'x' && 
-              (munchkin_y_factor1 + speed) > ((MAZE_OFFSET_Y + 8 + ((cell_y) * (VERT_LINE_SIZE - 2))))
+          if (game.horizontal_lines[cell_y + 1].line[cell_x] == 'x' && 
+              (game.munchkin_y_factor1 + game.speed) > ((MAZE_OFFSET_Y + 8 + ((cell_y) * (VERT_LINE_SIZE - 2))))
                                          // 4 munchkin offset in cel
               ) {
                    ;  // continue down (not at center of cell yet)
            } else {
               
               //if ( (cell_x == -1 && cell_y == 4) || (cell_x == 9 && cell_y == 4) ) { // cell_x == -1 not for unsigned char
-              if ( (munchkin_x_factor1 == 4 && cell_y == 4) || (cell_x == 9 && cell_y == 4) ) {
+              if ( (game.munchkin_x_factor1 == 4 && cell_y == 4) || (cell_x == 9 && cell_y == 4) ) {
                  ;   // if munchkin outside maze (wrap via tunnel) do not allow DOWN
               } else {
-                 munchkin_y_factor1 = munchkin_y_factor1 + speed;
-                 munchkin_auto_direction = DOWN;
-                 munchkin_last_direction = DOWN;
+                 game.munchkin_y_factor1 = game.munchkin_y_factor1 + game.speed;
+                 game.munchkin_auto_direction = DOWN;
+                 game.munchkin_last_direction = DOWN;
               } 
            }                  
         break;
@@ -686,61 +1390,79 @@ void handle_munchkin(unsigned char munchkin_direction, unsigned char munchkin_ma
   // auto direction
   // if munchkin at boundery of cell, stop auto movement
   //    only if automovement move munchkin
-  if (munchkin_auto_direction != 0 && munchkin_manual_move == 0) {    // if no key pressed but auto move
-    switch (munchkin_auto_direction) {
+  if (game.munchkin_auto_direction != 0 && munchkin_manual_move == 0) {    // if no key pressed but auto move
+    switch (game.munchkin_auto_direction) {
         case LEFT: 
          //if ( (munchkin_x_factor1 - (16)) % (20) == 0) munchkin_auto_direction = 0;
          //if ( (munchkin_x_factor1 - (39)) % (20) == 0) munchkin_auto_direction = 0;
              // now: (MAZE_OFFSET_X + MUNCHKIN_OFFSET_X_) % (HORI_LINE_SIZE - 2) , dus 16+12 % 26-2
              // 
-         if ( (munchkin_x_factor1 - (28)) % (24) == 0) munchkin_auto_direction = 0;
-          else { munchkin_x_factor1 = munchkin_x_factor1 - speed;
+         if ( (game.munchkin_x_factor1 - (28)) % (24) == 0) game.munchkin_auto_direction = 0;
+          else { game.munchkin_x_factor1 = game.munchkin_x_factor1 - game.speed;
                  //if (munchkin_x_factor1 < -4) munchkin_x_factor1 = 196;    // wrap screen left
                  //if (munchkin_x_factor1 < 19) munchkin_x_factor1 = 219;    // wrap screen left
-                 if (munchkin_x_factor1 < 4) munchkin_x_factor1 = 252;    // wrap screen left
-                 munchkin_last_direction = LEFT;
+                 if (game.munchkin_x_factor1 < 4) game.munchkin_x_factor1 = 252;    // wrap screen left
+                 game.munchkin_last_direction = LEFT;
                }  
         break;  
         case RIGHT: 
           //if ( (munchkin_x_factor1 - (80/5)) % (100/5) == 0) munchkin_auto_direction = 0;
           //if ( (munchkin_x_factor1 - (16)) % (20) == 0) munchkin_auto_direction = 0;
-          if ( (munchkin_x_factor1 - (28)) % (24) == 0) munchkin_auto_direction = 0;
-          else { munchkin_x_factor1 = munchkin_x_factor1 + speed;
+          if ( (game.munchkin_x_factor1 - (28)) % (24) == 0) game.munchkin_auto_direction = 0;
+          else { game.munchkin_x_factor1 = game.munchkin_x_factor1 + game.speed;
                  //if (munchkin_x_factor1 > 980/5) munchkin_x_factor1 = -20/5;    // wrap screen right
-                 if (munchkin_x_factor1 > 252) munchkin_x_factor1 = 4;    // wrap screen right
-                 munchkin_last_direction = RIGHT;
+                 if (game.munchkin_x_factor1 > 252) game.munchkin_x_factor1 = 4;    // wrap screen right
+                 game.munchkin_last_direction = RIGHT;
                }  
         break;  
         case UP:
           //  vertical SDL 23, Z88DK 40 : so 17 more
           //if ( (munchkin_y_factor1 - (135/5)) % (70/5) == 0) munchkin_auto_direction = 0;
           //if ( (munchkin_y_factor1 - (27)) % (14) == 0) munchkin_auto_direction = 0;
-          if ( (munchkin_y_factor1 - (40)) % (16) == 0) munchkin_auto_direction = 0;
-          else { munchkin_y_factor1 = munchkin_y_factor1 - speed;
-                 munchkin_last_direction = UP;
+          if ( (game.munchkin_y_factor1 - (40)) % (16) == 0) game.munchkin_auto_direction = 0;
+          else { game.munchkin_y_factor1 = game.munchkin_y_factor1 - game.speed;
+                 game.munchkin_last_direction = UP;
                }  
         break;  
         case DOWN: 
          //if ( (munchkin_y_factor1 - (135/5)) % (70/5) == 0) munchkin_auto_direction = 0;
          //if ( (munchkin_y_factor1 - (27)) % (14) == 0) munchkin_auto_direction = 0;
-         if ( (munchkin_y_factor1 - (40)) % (16) == 0) munchkin_auto_direction = 0;
-          else { munchkin_y_factor1 = munchkin_y_factor1 + speed;
-                 munchkin_last_direction = DOWN;
+         if ( (game.munchkin_y_factor1 - (40)) % (16) == 0) game.munchkin_auto_direction = 0;
+          else { game.munchkin_y_factor1 = game.munchkin_y_factor1 + game.speed;
+                 game.munchkin_last_direction = DOWN;
                }  
         break;  
     }
   }   // if no key pressed but auto move
-  
-  // play "move" sound
-  if (munchkin_manual_move != 0 || munchkin_auto_direction != 0) {
-        if (active_pills != 1 && frame % 5 == 0) {
-           playfx(FX_MOVE);
-        } else { if (active_pills == 1 && frame % 3 == 0)   // increase "move" sound when last pill on screen
-                 playfx(FX_MOVE);
-               }
+}
+
+
+// move a ghost or pill one step in its direction, wrap through the tunnel
+// and count down to the next node
+void move_actor(actor_type *actor)
+{
+  switch (actor->direction) {
+    case LEFT:
+         actor->x = actor->x - actor->speed;
+         if (actor->x < 8) actor->x += WRAP_WIDTH;  // wrap screen left
+       break;
+    case RIGHT:
+         actor->x = actor->x + actor->speed;
+         if (actor->x > 242) actor->x -= WRAP_WIDTH;  // wrap screen right
+       break;
+    case UP:
+         actor->y = actor->y - actor->speed;
+       break;
+    case DOWN:
+         actor->y = actor->y + actor->speed;
+       break;
   }
+
+  if (actor->countdown != 0) actor->countdown -= actor->speed;
 }
 
+#endif
+
 
 void get_user_input(void)
 {
@@ -754,10 +1476,10 @@ void get_user_input(void)
 
    /* Check continuous-response keys  */
    
-   if (munchkin_dying == FALSE) {
+   if (game.munchkin_dying == FALSE) {
 
        if (key & IN_STICK_LEFT && !(key & IN_STICK_RIGHT)) {
-           if (munchkin_auto_direction == UP || munchkin_auto_direction == DOWN) {   
+           if (game.munchkin_auto_direction == UP || game.munchkin_auto_direction == DOWN) {   
                ;  // // complete current auto move
            } else {
                     //if (munchkin_manual_move == 0) {   // is always 0 first if-statement
@@ -767,7 +1489,7 @@ void get_user_input(void)
            }
        }
        if (key & IN_STICK_RIGHT && !(key & IN_STICK_LEFT)) { 
-           if (munchkin_auto_direction == UP || munchkin_auto_direction == DOWN) {   
+           if (game.munchkin_auto_direction == UP || game.munchkin_auto_direction == DOWN) {   
                ;  // // complete current auto move
            } else {
                     if (munchkin_manual_move == 0) {
@@ -777,7 +1499,7 @@ void get_user_input(void)
            }    
        }
        if (key & IN_STICK_UP && !(key & IN_STICK_DOWN))  { 
-           if (munchkin_auto_direction == LEFT || munchkin_auto_direction == RIGHT) {   
+           if (game.munchkin_auto_direction == LEFT || game.munchkin_auto_direction == RIGHT) {   
                ;  // // complete current auto move
            } else {
                    if (munchkin_manual_move == 0) {
@@ -787,7 +1509,7 @@ void get_user_input(void)
            }    
        }    
        if (key & IN_STICK_DOWN && !(key & IN_STICK_UP))  { 
-           if (munchkin_auto_direction == LEFT || munchkin_auto_direction == RIGHT) {   
+           if (game.munchkin_auto_direction == LEFT || game.munchkin_auto_direction == RIGHT) {   
                ;  // // complete current auto move
            } else {
                    if (munchkin_manual_move == 0) {
@@ -797,12 +1519,12 @@ void get_user_input(void)
            }    
        }
 
-       munchkin_last_direction = munchkin_direction;
+       game.munchkin_last_direction = munchkin_direction;
 
        // when no key pressed and munchkin_auto_direction <> 0
        // move automatically in last direction
 
-       if (maze_completed == FALSE) {   
+       if (game.maze_completed == FALSE) {   
               handle_munchkin(munchkin_direction, munchkin_manual_move);
               //if (munchkin_manual_move != 0 || munchkin_auto_direction != 0 ) play_sound(11, 1); 
               //      else play_sound(16, 6); 
@@ -815,9 +1537,12 @@ void get_user_input(void)
 void run_play(void)
 {
    //unsigned char buffer[16];
+#ifdef FRAME_PACING
+   unsigned char catch_up = FALSE;    // this step makes up for a late one
+#endif
 
-   sp1_ClearRectInv(&cr, INK_WHITE | PAPER_BLACK, 32, SP1_RFLAG_TILE | SP1_RFLAG_COLOUR);
-   sp1_UpdateNow();
+   wait();     // vsync
+   clear_screen(INK_WHITE | PAPER_BLACK);
 
    start_new_game();
 
@@ -825,107 +1550,202 @@ void run_play(void)
    draw_pills();  
 
    // set up munchkin sprite (keeps living in the game forever)
-   munchkin_x_factor1 = (MAZE_OFFSET_X + 4 * (HORI_LINE_SIZE -2)) + 12;  // 112 + 12
-   munchkin_y_factor1 = (MAZE_OFFSET_Y + 3 * (VERT_LINE_SIZE -2)) + 8;  // 80  +  8
+   game.munchkin_x_factor1 = (MAZE_OFFSET_X + 4 * (HORI_LINE_SIZE -2)) + 12;  // 112 + 12
+   game.munchkin_y_factor1 = (MAZE_OFFSET_Y + 3 * (VERT_LINE_SIZE -2)) + 8;  // 80  +  8
+#ifdef PRESHIFT_MUNCHKIN
+   munchkin_sprite = sp1_CreateSpr(SP1_DRAW_MASK2NR, SP1_TYPE_2BYTE, 2, 0, 0);
+   sp1_AddColSpr(munchkin_sprite, SP1_DRAW_MASK2NR, SP1_TYPE_2BYTE, PRESHIFT_COLUMN, 0);
+#else
    munchkin_sprite = sp1_CreateSpr(SP1_DRAW_MASK2LB, SP1_TYPE_2BYTE, 2, 0, 0);
    sp1_AddColSpr(munchkin_sprite, SP1_DRAW_MASK2RB, SP1_TYPE_2BYTE, 0, 0);
+#endif
    
-   ink_colour = INK_CYAN;
+   ink_colour = MUNCHKIN_INK;
    sp1_IterateSprChar(munchkin_sprite, add_colour_to_sprite);
-   sp1_MoveSprPix(munchkin_sprite, &cr, 0, munchkin_x_factor1, munchkin_y_factor1);
+   sp1_MoveSprPix(munchkin_sprite, &cr, 0, game.munchkin_x_factor1, game.munchkin_y_factor1);
 
 
    // setup ghosts sprites
    
    for (i = 0; i < NUM_GHOSTS; i++)  {
-       ghosts[i].sprite = sp1_CreateSpr(SP1_DRAW_MASK2LB, SP1_TYPE_2BYTE, 2, 0, 0);
-       sp1_AddColSpr(ghosts[i].sprite, SP1_DRAW_MASK2RB, SP1_TYPE_2BYTE, 0, 0);
-       get_ink_colour(ghosts[i].colour);
-       sp1_IterateSprChar(ghosts[i].sprite, add_colour_to_sprite);
+#ifdef PRESHIFT_GHOSTS
+       game.ghosts[i].sprite = sp1_CreateSpr(SP1_DRAW_MASK2NR, SP1_TYPE_2BYTE, 2, 0, 0);
+       sp1_AddColSpr(game.ghosts[i].sprite, SP1_DRAW_MASK2NR, SP1_TYPE_2BYTE, PRESHIFT_COLUMN, 0);
+#else
+       game.ghosts[i].sprite = sp1_CreateSpr(SP1_DRAW_MASK2LB, SP1_TYPE_2BYTE, 2, 0, 0);
+       sp1_AddColSpr(game.ghosts[i].sprite, SP1_DRAW_MASK2RB, SP1_TYPE_2BYTE, 0, 0);
+#endif
+       get_ink_colour(game.ghosts[i].colour);
+       sp1_IterateSprChar(game.ghosts[i].sprite, add_colour_to_sprite);
    } 
     
 
    /* ------------------
       - Main game loop -
       ------------------ */
+#ifdef FRAME_PACING
+   timer = tick;
+#endif
+#ifdef FRAME_STATS
+   memset(frame_stats, 0, sizeof(frame_stats));
+   frame_stats_tick = tick;
+#endif
    while(1)
    {
       //timer = tick;
 
+#ifdef FRAME_STATS
+      i = tick - frame_stats_tick;       // frames of the last step (0: the first one)
+      frame_stats_tick = tick;
+      if (i > 4) i = 4;
+      if (i != 0) frame_stats[i - 1]++;
+#endif
+
+#if SPRITE_BUDGET
+      sprite_budget = SPRITE_BUDGET - SPRITE_CHARS;   // the munchkin is always drawn
+#endif
+
       if (in_inkey() == 12) {   // backspace on PC keyboard
          hide_sprites();    // to clear all sprites
          break;             // exit current game
       }   
+
+#ifdef GAME_SNAPSHOT
+      if (in_inkey() == '1') save_game(&snapshot);
+      if (in_inkey() == '2') restore_game(&snapshot);   // nothing before the first save
+#endif
       
       /* restart_game after death */
-      if (munchkin_dying == TRUE && munchkin_dying_animation == 15) {
+      if (game.munchkin_anim.frame->flags & ANIM_NEW_GAME) {
          hide_sprites();    // to clear all sprites
          start_new_game();
       }  
 
       /* continue after completion maze */
-      if (maze_completed == TRUE && maze_completed_animations == 0) {
-              maze_completed = FALSE;   
+      if (game.maze_completed == TRUE && game.maze_completed_animations == 0) {
+              game.maze_completed = FALSE;   
               for (i = 0; i < 16; ++i) wait();   // pauze
               // hide all ghosts   
               for (i = 0; i < NUM_GHOSTS; i++) {
-                 sp1_MoveSprAbs(ghosts[i].sprite, &cr, NULL, 0, 34, 0, 0);
-                 get_ink_colour(ghosts[i].colour);  // set to original colour
-                 sp1_IterateSprChar(ghosts[i].sprite, add_colour_to_sprite);
+                 sp1_MoveSprAbs(game.ghosts[i].sprite, &cr, NULL, 0, 34, 0, 0);
+                 get_ink_colour(game.ghosts[i].colour);  // set to original colour
+                 sp1_IterateSprChar(game.ghosts[i].sprite, add_colour_to_sprite);
               } 
               sp1_UpdateNow();   
               // next maze
-              if (maze_selected == 1) maze_selected = 2;
-                 else maze_selected = 1;
+              if (game.num_chasers != 0 && game.num_chasers < NUM_GHOSTS) game.num_chasers++;   // harder next maze
+              game.mazes_completed++;
+              if (game.maze_selected == 1) game.maze_selected = 2;
+                 else game.maze_selected = 1;
               start_new_maze();
       }  
 
       get_user_input();  // also calls handle_munchkin();
+
+      if (game.num_chasers != 0 || game.pill_flee != 0) update_flow_field();   // shared by ghosts and pills
       
       draw_munchkin();
 
-      if (maze_completed == TRUE) handle_maze_completed();
+      if (game.maze_completed == TRUE) handle_maze_completed();
 
-      if (frame % 3 == 0 || active_pills == 1) check_pill_eaten();
+      if (game.frame % 3 == 0 || game.active_pills == 1) check_pill_eaten();
 
-      if (munchkin_dying == FALSE || munchkin_dying_animation == 0) handle_ghosts();
+      if (!(game.munchkin_anim.frame->flags & ANIM_STOP_GHOSTS)) handle_ghosts();
 
       /* draw ghosts if munchkin is not dead or munchkin is just dying */
-      if (munchkin_dying == FALSE || munchkin_dying_animation <= 2) draw_ghosts();
+      if (!(game.munchkin_anim.frame->flags & ANIM_NO_GHOSTS)) draw_ghosts();
 
-      /* stop drawing ghost if munchkin is almost dead and dying animation == 3 */
-      if (munchkin_dying == TRUE && munchkin_dying_animation == 3) {
+      /* stop drawing ghost if munchkin is almost dead (see munchkin_dying_anim) */
+      if (game.munchkin_anim.frame->flags & ANIM_HIDE_GHOSTS) {
            for (i = 0; i < NUM_GHOSTS; i++) 
-              sp1_MoveSprAbs(ghosts[i].sprite, &cr, NULL, 0, 34, 0, 0); // hide ghosts
+              sp1_MoveSprAbs(game.ghosts[i].sprite, &cr, NULL, 0, 34, 0, 0); // hide ghosts
                                                                         // move to column 34
       }
 
-      if (maze_completed == FALSE) check_ghosts_hits_munchkin();
+      if (game.maze_completed == FALSE) check_ghosts_hits_munchkin();
 
-      if (active_pills == 1) {   // last pill moves as fast as munchkin
+      if (game.active_pills == 1) {   // last pill moves as fast as munchkin
+#ifndef FRAME_PACING
          intrinsic_halt();  // to slow down frame rate a bit
+#endif
          handle_pills();
          draw_pills();
       } else {   
-         if (frame % 5 == 0) {  // handle pills every 5 frames
+         // with PILL_BATCHES groups (PILL_STORM) handle_pills() moves one group each frame,
+         // so every pill already moves once per 5 frames and the % 5 gate must not apply
+         if (PILL_BATCHES != 1 || game.frame % 5 == 0) {  // handle pills every 5 frames (or a group every frame)
              handle_pills();
              draw_pills();
-         }   
+         } else if (SPRITE_BUDGET != 0) {
+             draw_pills();       // the ones that did not fit in an earlier frame
+         }
       }
 
-      check_pills_mask();
+      resolve_colours();
 
-      if (frame % 20 == 0 && maze_completed == FALSE) rotate_maze_center();    // rotate maze center
+      if (game.frame % 20 == 0 && game.maze_completed == FALSE) rotate_maze_center();    // rotate maze center
 
-      frame++;
+      game.frame++;
 
+#ifdef FRAME_PACING
+      // one step per WFRAMES frames; after a late one the next step follows
+      // straight away without waiting or drawing, so the game keeps its speed
+      if (catch_up == FALSE) {
+         catch_up = (wait() > WFRAMES);
+         update_screen();
+      } else {
+         catch_up = FALSE;
+#ifdef BEAM_RACING
+         update_bands(FALSE);
+#endif
+      }
+#else
       intrinsic_halt();   // inline halt without impeding optimizer  
-      sp1_UpdateNow();
+      update_screen();
+#endif
    }  // main loop
 
 
-   sp1_ClearRectInv(&cr, INK_BLACK | PAPER_BLACK, 32, SP1_RFLAG_TILE | SP1_RFLAG_COLOUR);
-   sp1_UpdateNow();
+   // give the sprites back to the block allocator, the next game creates them again
+   sp1_DeleteSpr(munchkin_sprite);
+   for (i = 0; i < NUM_GHOSTS; i++) sp1_DeleteSpr(game.ghosts[i].sprite);
+
+   // the screen is cleared by draw_menu()
+}
+
+
+void anim_start(anim_type *a, const anim_frame_type *sequence)
+{
+  a->sequence = sequence;
+  a->frame = sequence;
+  a->steps = sequence->steps;
+  if (sequence->sound != NO_SOUND) bit_beepfx_di(beepfx[sequence->sound].effect);
+}
+
+
+// a different sequence from its start, the same one goes on
+void anim_select(anim_type *a, const anim_frame_type *sequence)
+{
+  if (a->sequence != sequence) anim_start(a, sequence);
+}
+
+
+// TRUE when the next frame starts
+unsigned char anim_step(anim_type *a)
+{
+  if (a->steps == 0 || --a->steps != 0) return FALSE;
+
+  ++a->frame;
+  if (a->frame->steps == 0) {          // end of the sequence
+     if (a->frame->image == ANIM_HOLD) {
+        --a->frame;                    // a->steps stays 0
+        return FALSE;
+     }
+     a->frame = a->sequence + a->frame->sound;
+  }
+  a->steps = a->frame->steps;
+  if (a->frame->sound != NO_SOUND) bit_beepfx_di(beepfx[a->frame->sound].effect);
+  return TRUE;
 }
 
 
@@ -933,90 +1753,68 @@ void draw_munchkin(void)
 {
   unsigned char image_num;  
 
- if (maze_completed == FALSE) {
-      // determine which image to display
-      switch (munchkin_last_direction) {
-      case 0:
-          image_num = 0;    // 2;     // stationary
-          break;
-      case LEFT:
-          image_num = 1;    //3;     // left
-          break;
-      case RIGHT:
-          image_num = 2;    //4;     // right
-          break;
-      case UP:
-          image_num = 4;    //72;     // up
-          break;
-      case DOWN:
-          image_num = 5;    //73;     // down
-          break;
-      }
+  image_num = game.munchkin_anim.frame->image;
+  if (image_num == IMAGE_WALK) {
+     if (game.munchkin_last_direction == 0) {
+        image_num = MUNCHKIN_STOPPED;  // the mouth waits
+     } else {
+        image_num = game.munchkin_walk.frame->image;
+        if (image_num == IMAGE_DIRECTION) image_num = munchkin_direction_image[game.munchkin_last_direction];
+        anim_step(&game.munchkin_walk);
+     }
+  }
 
-      if (munchkin_last_direction != 0) {    // only if moving 
-            if (munchkin_animation_frame == 0 || munchkin_animation_frame == 1 || munchkin_animation_frame == 2)
-                 image_num = 3;  // 6;    // close image,  animation toggle 3 frames delay
-            munchkin_animation_frame ++;
-            if (munchkin_animation_frame == 6)  munchkin_animation_frame = 0;
-      } 
-
-   } else { // maze completed, animate munchkin   
-            //printf("maze color %c\n", maze_color);
-            ;
-            if (maze_color == '3')
-              image_num = 7;  // munchkin mouth open
-            else 
-              image_num = 6;  // munchkin mouth close
-              
-  }   // if maze_completed == FALSE
-  
+  if (image_num == IMAGE_HIDDEN) {
+     sp1_MoveSprAbs(munchkin_sprite, &cr, NULL, 0, 34, 0, 0); // hide 
+  } else {
+     move_sprite(munchkin_sprite, munchkin_graphic(image_num), game.munchkin_x_factor1, game.munchkin_y_factor1);
+  }
 
+  if (game.munchkin_dying == TRUE && game.frame % 10 == 0) {   // next dying frame every 10 steps
+     anim_step(&game.munchkin_anim);
+  }
+}
 
-  if (munchkin_dying == TRUE) {
-      // determine which image to display
-      switch (munchkin_dying_animation) {
-      case 2:
-          image_num = 7; //76;     
-          break;
-      case 3:
-          image_num = 6; //75;     
-          break;
-      case 4:
-          image_num = 8; //143;     
-          break;
-      case 5:
-          image_num = 9; //144;    
-          break;
-      case 6:
-          image_num = 10; //145;  
-          break;
-      case 7:
-          image_num = 11; //146;    
-          break;
-      case 8:
-          image_num = 12; //147;    
-          //printf("GAME OVER\n");
-          //flash_high_score_timer = 55;  // +/- 5 seconds : flashing highscore name
-          break;
-      }
-      if (munchkin_dying_animation > 8) {
-         sp1_MoveSprAbs(munchkin_sprite, &cr, NULL, 0, 34, 0, 0); // hide 
-      } else {
-         sp1_MoveSprPix(munchkin_sprite, &cr, munchkin_sprite_graphic[image_num].graphic, munchkin_x_factor1, munchkin_y_factor1);
-      }   
-      
-      if (frame % 10 == 0) {        // increase animation every x frames
-        munchkin_dying_animation++;
-        if (munchkin_dying_animation == 3)
-            bit_beepfx_di(beepfx[5].effect); 
-        if (munchkin_dying_animation == 6)
-            bit_beepfx_di(beepfx[4].effect);  
-      }
-   }  // munchkin_dying
 
-  if (munchkin_dying == FALSE)   
-      sp1_MoveSprPix(munchkin_sprite, &cr, munchkin_sprite_graphic[image_num].graphic, munchkin_x_factor1, munchkin_y_factor1);
+// frame of a munchkin image at its x position (see PRESHIFT_MUNCHKIN)
+unsigned char *munchkin_graphic(unsigned char image_num)
+{
+#ifdef PRESHIFT_MUNCHKIN
+  if (image_num < MUNCHKIN_SHIFTED)
+     return shifted_frame(munchkin_shifted_graphic[image_num].shifted, game.munchkin_x_factor1);
+
+  // not moving (completed or dying): shifted once per image and position
+  if (munchkin_shift_image != image_num || munchkin_shift_x != game.munchkin_x_factor1) {
+     munchkin_shift_image = image_num;
+     munchkin_shift_x = game.munchkin_x_factor1;
+     shift_frame(munchkin_shift_buffer, munchkin_sprite_graphic[image_num].graphic, munchkin_shift_x & 7);
+  }
+  return munchkin_shift_buffer + 7 * 2;
+#else
+  return munchkin_sprite_graphic[image_num].graphic;
+#endif
+}
+
+
+#ifdef PRESHIFT_MUNCHKIN
+// one shift of an sp1 frame (8 rows of mask, graphic) as tools/preshift.py makes them
+void shift_frame(unsigned char *dst, unsigned char *graphic, unsigned char shift)
+{
+  unsigned char row;
+
+  for (row = 0; row < 7 + 8 + 8 + 8 + 8; ++row) {    // blank rows
+     dst[row * 2] = 0xff;
+     dst[row * 2 + 1] = 0x00;
+  }
+  dst += 7 * 2;
+  for (row = 0; row < 8 * 2; row += 2) {
+     dst[row] = (graphic[row] >> shift) | (0xff << (8 - shift));
+     dst[row + 1] = graphic[row + 1] >> shift;
+     dst[PRESHIFT_COLUMN + row] = (graphic[row] << (8 - shift)) | (0xff >> shift);
+     dst[PRESHIFT_COLUMN + row + 1] = graphic[row + 1] << (8 - shift);
+  }
 }
+#endif
 
 
 void setup_ghosts(void)
@@ -1027,17 +1825,18 @@ void setup_ghosts(void)
   // ghost_y = (79 + 4) * factor;  //23 + 4*14 + 4 = (MAZE_OFFSET_Y + 4 * (VERT_LINE_SIZE -2) + 8) * factor
 
   for (i = 0; i < NUM_GHOSTS; i++)  {
-       ghosts[i].colour = (i % 4) + 1;
-       ghosts[i].status = 1;
-       ghosts[i].recharge_timer = 0;
-       ghosts[i].x = (MAZE_OFFSET_X + 4 * (HORI_LINE_SIZE -2) + 12);
-       ghosts[i].y = (MAZE_OFFSET_Y + 4 * (VERT_LINE_SIZE -2) + 8);
+       game.ghosts[i].colour = (i % 4) + 1;
+       game.ghosts[i].status = GHOST_NORMAL;      // (sprites do not exist yet, colour is set in run_play)
+       game.ghosts[i].timer = 0;
+       game.ghosts[i].x = (MAZE_OFFSET_X + 4 * (HORI_LINE_SIZE -2) + 12);
+       game.ghosts[i].y = (MAZE_OFFSET_Y + 4 * (VERT_LINE_SIZE -2) + 8);
        //ghosts[i].x = (MAZE_OFFSET_X + ((i) * (HORI_LINE_SIZE - 2 )) + 12);
        //ghosts[i].y = (MAZE_OFFSET_Y + ((i) * (VERT_LINE_SIZE - 2 )) + 8);
 
-       ghosts[i].direction = DOWN;
-       ghosts[i].speed = speed;  // same speed as munchkin
-       ghosts[i].gulp_sound_delay = 0;
+       game.ghosts[i].direction = DOWN;
+       game.ghosts[i].speed = ghost_states[GHOST_NORMAL].speed;
+       game.ghosts[i].gulp_sound_delay = 0;
+       game.ghosts[i].countdown = 0;              // choose a direction on the first move
 
    }   
 }
@@ -1045,91 +1844,139 @@ void setup_ghosts(void)
 
 void draw_ghosts(void)
 {
-  unsigned char image_num;
+  unsigned char k;
+#if SPRITE_BUDGET
+  unsigned char n;
+#endif
+
+  // flash ghost if powerpill almost not active anymore
+  if (game.powerpill_active_timer > 0 && game.powerpill_active_timer < 20)
+     anim_select(&ghost_anims[FRAMES_POWERPILL], ghost_blink_anim);
+  else
+     anim_select(&ghost_anims[FRAMES_POWERPILL], ghost_steady_anim);
+
+  // images for this frame, then one lookup per ghost
+  for (k = 0; k < 3; k++) {
+     ghost_frame[k] = ghost_anims[k].frame->image;
+     anim_step(&ghost_anims[k]);
+  }
 
+#if SPRITE_BUDGET
   for (i = 0; i < NUM_GHOSTS; i++)  {
-     switch (ghosts[i].status) {
-     case  1:  // normal
-        image_num = 0;
-        break;
-     case  2:  // can be eaten
-        image_num = 0;
-        break;
-     case 3:   // dead ,invisible
-        image_num = 2;
-        break;
-     case 5:   // recharging
-        image_num = 2;
-        break;
+     if (ghost_states[game.ghosts[i].status].frames != FRAMES_DEAD) {
+        sprite_budget -= SPRITE_CHARS;
+        draw_ghost(i);
      }
-     // flash ghost if powerpill almost not active anymore
-     if (ghosts[i].status == 2 && powerpill_active_timer > 0 && powerpill_active_timer < 20) {
-             if (powerpill_active_timer % 4 == 0) {
-               image_num = 0;
-             } else {  
-               image_num = 1;
-             } 
-     } else {     
-         if (ghosts[i].status == 3 || ghosts[i].status == 4 ) { // dead or recharging
-            if (frame % 16 >= 0 && frame % 16 <=2) {  // 3 frames normal and 9 frames invisible
-                image_num = 0;
-            } else {
-               image_num = 1;
-            }    
-         }   
+  }
+  // eaten and recharging ghosts (mostly invisible) if they fit, in turns
+  i = ghost_turn;
+  for (n = 0; n < NUM_GHOSTS; n++)  {
+     if (ghost_states[game.ghosts[i].status].frames == FRAMES_DEAD) {
+        if (sprite_fits() == FALSE) {
+           ghost_turn = i;      // first in the next frame
+           break;
+        }
+        draw_ghost(i);
      }
-     sp1_MoveSprPix(ghosts[i].sprite, &cr, 
-                    ghost_sprite_graphic[image_num].graphic,
-                    ghosts[i].x, ghosts[i].y);
-   }   
+     if (++i == NUM_GHOSTS) i = 0;
+  }
+#else
+  for (i = 0; i < NUM_GHOSTS; i++) draw_ghost(i);
+#endif
 }
 
 
-void handle_ghosts(void)
+void draw_ghost(unsigned char i)
+{
+  move_sprite(game.ghosts[i].sprite,
+                 ghost_graphic(ghost_frame[ghost_states[game.ghosts[i].status].frames], game.ghosts[i].x),
+                 game.ghosts[i].x, game.ghosts[i].y);
+}
+
+
+#ifdef BEAM_RACING
+void move_sprite(struct sp1_ss *s, unsigned char *frame, unsigned char x, unsigned char y)
 {
-  if (powerpill_active_timer > 0) powerpill_active_timer --;
+  sprite_move_type *m;
 
-  if (powerpill_active_timer == 0) {   // timer completed, put ghosts to active
-        for (i = 0; i < NUM_GHOSTS && maze_completed == FALSE; i++) {
-             if (ghosts[i].status == 2) {   // can be eaten 
-                // change to original colour
+  m = &sprite_moves[num_sprite_moves++];
+  m->sprite = s;
+  m->frame = frame;
+  m->x = x;
+  m->y = y;
+}
+
+
+// the sprite moves of this step and the screen update, in two bands (see BEAM_RACING),
+// draw == FALSE: only the moves (a catch-up step of FRAME_PACING)
+void update_bands(unsigned char draw)
+{
+  sprite_move_type *m;
+
+  for (m = sprite_moves; m < sprite_moves + num_sprite_moves; ++m) {
+     if (m->y < BAND_SPLIT) sp1_MoveSprPix(m->sprite, &cr, m->frame, m->x, m->y);
+  }
+  if (draw) sp1_UpdateNow();        // top band and whatever else changed
+  for (m = sprite_moves; m < sprite_moves + num_sprite_moves; ++m) {
+     if (m->y >= BAND_SPLIT) sp1_MoveSprPix(m->sprite, &cr, m->frame, m->x, m->y);
+  }
+  if (draw) sp1_UpdateNow();        // bottom band
+  num_sprite_moves = 0;
+}
+#endif
+
+
+#if SPRITE_BUDGET
+// TRUE and taken from the budget if a low priority sprite still fits in this frame
+unsigned char sprite_fits(void)
+{
+  if (sprite_budget < SPRITE_CHARS) return FALSE;
+  sprite_budget -= SPRITE_CHARS;
+  return TRUE;
+}
+#endif
+
+
+void handle_ghosts(void)
+{
+  if (game.powerpill_active_timer > 0) game.powerpill_active_timer --;
+
+  // alternate chase and scatter phases (only matters for chasing ghosts)
+  game.ghost_mode_timer--;
+  if (game.ghost_mode_timer == 0) {
+     if (game.ghosts_chasing == TRUE) {
+        game.ghosts_chasing = FALSE;
+        game.ghost_mode_timer = SCATTER_FRAMES;
+     } else {
+        game.ghosts_chasing = TRUE;
+        game.ghost_mode_timer = CHASE_FRAMES;
+     }
+  }
 
-             get_ink_colour(ghosts[i].colour);
-             sp1_IterateSprChar(ghosts[i].sprite, add_colour_to_sprite);
-             ghosts[i].status = 1;
-             }     
+  if (game.powerpill_active_timer == 0) {   // timer completed, put ghosts to active
+        for (i = 0; i < NUM_GHOSTS && game.maze_completed == FALSE; i++) {
+             if (game.ghosts[i].status == GHOST_FRIGHTENED)
+                set_ghost_state(i, ghost_states[GHOST_FRIGHTENED].next);
         }  // for loop
   }
 
-  for (i = 0; i < NUM_GHOSTS && maze_completed == FALSE; i++) {
+  for (i = 0; i < NUM_GHOSTS && game.maze_completed == FALSE; i++) {
 
-             if (ghosts[i].gulp_sound_delay > 0) {   // post gulp sound
-               if (ghosts[i].gulp_sound_delay == 1) bit_beepfx_di(beepfx[2].effect);
-               ghosts[i].gulp_sound_delay--;
+             if (game.ghosts[i].gulp_sound_delay > 0) {   // post gulp sound
+               if (game.ghosts[i].gulp_sound_delay == 1) bit_beepfx_di(beepfx[2].effect);
+               game.ghosts[i].gulp_sound_delay--;
              } else {
 
-             choose_ghost_direction(i);
-
-             switch (ghosts[i].direction) {
-               case LEFT:   
-                    ghosts[i].x = ghosts[i].x - ghosts[i].speed;
-                    //if (ghosts[i].x < -2) ghosts[i].x = 194;  // wrap screen left
-                    //if (ghosts[i].x < 21) ghosts[i].x = 217;  // wrap screen left                    
-                    if (ghosts[i].x < 8) ghosts[i].x = 242;  // wrap screen left                    
-                  break;
-               case RIGHT:   
-                    ghosts[i].x = ghosts[i].x + ghosts[i].speed;
-                    //if (ghosts[i].x > 194) ghosts[i].x = -2;  // wrap screen right
-                    //if (ghosts[i].x > 217) ghosts[i].x = 21;  // wrap screen right
-                    if (ghosts[i].x > 242) ghosts[i].x = 8;  // wrap screen right
-                  break;
-               case UP:   
-                    ghosts[i].y = ghosts[i].y - ghosts[i].speed;
-                  break;
-               case DOWN:    
-                    ghosts[i].y = ghosts[i].y + ghosts[i].speed;
-                   break;
-              }   // end switch
+             // timed states (recharging) move on when the timer runs out
+             if (game.ghosts[i].timer != 0) {
+                game.ghosts[i].timer--;
+                if (game.ghosts[i].timer == 0) set_ghost_state(i, ghost_states[game.ghosts[i].status].next);
+             }
+
+             // only decide at a node, in a corridor just follow the countdown
+             if (game.ghosts[i].countdown == 0) choose_ghost_direction(i);
+
+             move_actor((actor_type *) &game.ghosts[i]);
            }      //ghosts[i].gulp_sound_delay > 0)
     }             // for loop
 }
@@ -1137,270 +1984,283 @@ void handle_ghosts(void)
 
 void choose_ghost_direction (unsigned char i)
 {
-  unsigned char cell_nr_x, cell_nr_y, cell_x_ghost, cell_y_ghost;
+  unsigned char cell_nr_x, cell_nr_y;
   unsigned char left_open, right_open, up_open, down_open;     //1=open, 0=closed
   unsigned char direction_to_center_set;
   unsigned char found;
+  unsigned char cell, exits;
+
+  // only called when the countdown has run out, so the ghost is exactly
+  // in the middle of a (node) cell
 
   // cell_nr_x = ( (ghosts[i].x) - (12 + MAZE_OFFSET_X) ) / (HORI_LINE_SIZE - 2);  
   // cell_nr_y = ( (ghosts[i].y) - (8 + MAZE_OFFSET_Y) ) / (VERT_LINE_SIZE - 2);  
   // calculated before to speed up things
-  cell_nr_x = ( (ghosts[i].x) - (28) ) / (24);  // truncated to nearest cell
-  cell_nr_y = ( (ghosts[i].y) - (40) ) / (16);  // truncated to nearest cell
-
-
-  //cell_x_ghost = (16 + 12 + cell_nr_x * 24);  // MAZE_OFFSET_X + 12 + cell_nr_x * (HORI_LINE_SIZE - 2)
-  //cell_y_ghost = (32 +  8 + cell_nr_y * 16);  // MAZE_OFFSET_Y +  8 + cell_nr_y * (VERT_LINE_SIZE - 2)
-  // calculated before to speed up things
-  cell_x_ghost = (28 + cell_nr_x * 24);  // MAZE_OFFSET_X + 12 + cell_nr_x * (HORI_LINE_SIZE - 2)
-  cell_y_ghost = (40 + cell_nr_y * 16);  // MAZE_OFFSET_Y +  8 + cell_nr_y * (VERT_LINE_SIZE - 2)
-
-
-  direction_to_center_set = FALSE;     // for ghosts with status 3, going to center
+  cell_nr_x = ( (game.ghosts[i].x) - (28) ) / (24);  // truncated to nearest cell
+  cell_nr_y = ( (game.ghosts[i].y) - (40) ) / (16);  // truncated to nearest cell
+  cell = cell_nr_y * NUM_HORI_CELLS + cell_nr_x;
+
+  direction_to_center_set = FALSE;     // for eaten ghosts, going to center
+
+  // determine available directions
+  exits = maze_exits[game.maze_center_open - 1][cell];
+  if (exits & EXIT_LEFT)  left_open = 1;  else left_open = 0;
+  if (exits & EXIT_RIGHT) right_open = 1; else right_open = 0;
+  if (exits & EXIT_UP)    up_open = 1;    else up_open = 0;
+  if (exits & EXIT_DOWN)  down_open = 1;  else down_open = 0;
+
+  if (ghost_states[game.ghosts[i].status].move == MOVE_HOME) {  // eaten, looking for center
+      if (cell_nr_x == 4 && cell_nr_y == 4) {
+          //printf("Ghost %d reached center, going to recharge\n",i);
+          set_ghost_state(i, ghost_states[game.ghosts[i].status].next);   // stands still
+
+        } else {  // try to move into center if nearby
+
+          /* check movement to center when at cell (3,4) */
+          if (cell_nr_x == 3 && cell_nr_y == 4 && right_open == 1) {
+             game.ghosts[i].direction = RIGHT;
+             direction_to_center_set = TRUE;
+          }
+          /* stay around cell (3,4) if center was not open */
+          if (cell_nr_x == 3 && cell_nr_y == 4 && direction_to_center_set == FALSE) {
+             if (game.ghosts[i].direction == UP && up_open == 1)     game.ghosts[i].direction = UP;    // continue up
+             else if (game.ghosts[i].direction == UP && up_open == 0 && left_open == 1)   game.ghosts[i].direction = LEFT;   // NEW
+             else if (game.ghosts[i].direction == UP && up_open == 0 && down_open == 1)   game.ghosts[i].direction = DOWN;   // NEW
+             else if (game.ghosts[i].direction == DOWN && down_open == 1) game.ghosts[i].direction = DOWN;  // continue down
+             else if (game.ghosts[i].direction == DOWN && down_open == 0 && left_open == 1) game.ghosts[i].direction = LEFT;  // NEW
+             else if (game.ghosts[i].direction == DOWN && down_open == 0 && left_open == 0) game.ghosts[i].direction = UP;  // NEW
+             else if (game.ghosts[i].direction == RIGHT && up_open == 1)  game.ghosts[i].direction = UP; 
+             else if (game.ghosts[i].direction == RIGHT && up_open == 0 && down_open == 1) 
+                   game.ghosts[i].direction = DOWN; 
+             else if (game.ghosts[i].direction == RIGHT && up_open == 0 && down_open == 0) 
+                   game.ghosts[i].direction = LEFT;  // go back
+
+             direction_to_center_set = TRUE;
+          }
 
-  if (cell_x_ghost == ghosts[i].x && cell_y_ghost == ghosts[i].y) { // ghost exactly in middle of cell
-     
-     // determine available directions
-     if (vertical_lines[cell_nr_y].line[cell_nr_x] == '|')       left_open  = 0; else left_open = 1;
-     if (vertical_lines[cell_nr_y].line[cell_nr_x + 1] == '|')   right_open = 0; else right_open = 1;
-     if (horizontal_lines[cell_nr_y].line[cell_nr_x] == 'x')     up_open = 0;    else up_open = 1;
-     if (horizontal_lines[cell_nr_y + 1].line[cell_nr_x] == 'x') down_open = 0;  else down_open = 1;
-
-     if (ghosts[i].status == 3) {  // eaten, looking for center
-         if (cell_nr_x == 4 && cell_nr_y == 4) {
-             //printf("Ghost %d reached center, going to recharge\n",i);
-             ghosts[i].status = 4;
-             ghosts[i].direction = 0;
-             ghosts[i].recharge_timer = 150; 
-
-           } else {  // try to move into center if nearby
-
-             /* check movement to center when at cell (3,4) */
-             if (cell_nr_x == 3 && cell_nr_y == 4 && right_open == 1) {
-                ghosts[i].direction = RIGHT;
-                direction_to_center_set = TRUE;
-             }
-             /* stay around cell (3,4) if center was not open */
-             if (cell_nr_x == 3 && cell_nr_y == 4 && direction_to_center_set == FALSE) {
-                if (ghosts[i].direction == UP && up_open == 1)     ghosts[i].direction = UP;    // continue up
-                else if (ghosts[i].direction == UP && up_open == 0 && left_open == 1)   ghosts[i].direction = LEFT;   // NEW
-                else if (ghosts[i].direction == UP && up_open == 0 && down_open == 1)   ghosts[i].direction = DOWN;   // NEW
-                else if (ghosts[i].direction == DOWN && down_open == 1) ghosts[i].direction = DOWN;  // continue down
-                else if (ghosts[i].direction == DOWN && down_open == 0 && left_open == 1) ghosts[i].direction = LEFT;  // NEW
-                else if (ghosts[i].direction == DOWN && down_open == 0 && left_open == 0) ghosts[i].direction = UP;  // NEW
-                else if (ghosts[i].direction == RIGHT && up_open == 1)  ghosts[i].direction = UP; 
-                else if (ghosts[i].direction == RIGHT && up_open == 0 && down_open == 1) 
-                      ghosts[i].direction = DOWN; 
-                else if (ghosts[i].direction == RIGHT && up_open == 0 && down_open == 0) 
-                      ghosts[i].direction = LEFT;  // go back
-
-                direction_to_center_set = TRUE;
-             }
+          /* check movement to center when at cell (5,4) */
+          /* (a bit ugly, sorry) */
 
-             /* check movement to center when at cell (5,4) */
-             /* (a bit ugly, sorry) */
+          if (cell_nr_x == 5 && cell_nr_y == 4 && left_open == 1) {
+           game.ghosts[i].direction = LEFT;
+           direction_to_center_set = TRUE;
+          }
+          /* stay around cell (5,4) if center was not open */
+          if (cell_nr_x == 5 && cell_nr_y == 4 && direction_to_center_set == FALSE) {
+             if (game.ghosts[i].direction == UP && up_open == 1)     game.ghosts[i].direction = UP;    // continue up
+             else if (game.ghosts[i].direction == UP && up_open == 0 && right_open == 1)     game.ghosts[i].direction = RIGHT;    // NEW
+             else if (game.ghosts[i].direction == UP && up_open == 0 && right_open == 0)     game.ghosts[i].direction = DOWN;    // NEW
+             else if (game.ghosts[i].direction == DOWN && down_open == 1) game.ghosts[i].direction = DOWN;  // continue down
+             else if (game.ghosts[i].direction == DOWN && down_open == 0 && right_open == 1) game.ghosts[i].direction = RIGHT;  // NEW
+             else if (game.ghosts[i].direction == DOWN && down_open == 0 && right_open == 0) game.ghosts[i].direction = UP;  // NEW
+             else if (game.ghosts[i].direction == LEFT && up_open == 1)   game.ghosts[i].direction = UP; 
+             else if (game.ghosts[i].direction == LEFT && up_open == 0 && down_open == 1) 
+                   game.ghosts[i].direction = DOWN; 
+             else if (game.ghosts[i].direction == LEFT && up_open == 0 && down_open == 0) 
+                   game.ghosts[i].direction = RIGHT;  // go back
+
+             direction_to_center_set = TRUE;
+          }
 
-             if (cell_nr_x == 5 && cell_nr_y == 4 && left_open == 1) {
-              ghosts[i].direction = LEFT;
-              direction_to_center_set = TRUE;
-             }
-             /* stay around cell (5,4) if center was not open */
-             if (cell_nr_x == 5 && cell_nr_y == 4 && direction_to_center_set == FALSE) {
-                if (ghosts[i].direction == UP && up_open == 1)     ghosts[i].direction = UP;    // continue up
-                else if (ghosts[i].direction == UP && up_open == 0 && right_open == 1)     ghosts[i].direction = RIGHT;    // NEW
-                else if (ghosts[i].direction == UP && up_open == 0 && right_open == 0)     ghosts[i].direction = DOWN;    // NEW
-                else if (ghosts[i].direction == DOWN && down_open == 1) ghosts[i].direction = DOWN;  // continue down
-                else if (ghosts[i].direction == DOWN && down_open == 0 && right_open == 1) ghosts[i].direction = RIGHT;  // NEW
-                else if (ghosts[i].direction == DOWN && down_open == 0 && right_open == 0) ghosts[i].direction = UP;  // NEW
-                else if (ghosts[i].direction == LEFT && up_open == 1)   ghosts[i].direction = UP; 
-                else if (ghosts[i].direction == LEFT && up_open == 0 && down_open == 1) 
-                      ghosts[i].direction = DOWN; 
-                else if (ghosts[i].direction == LEFT && up_open == 0 && down_open == 0) 
-                      ghosts[i].direction = RIGHT;  // go back
-
-                direction_to_center_set = TRUE;
-             }
+          /* check movement to center when at cell (4,3) */
+          if (cell_nr_x == 4 && cell_nr_y == 3 && down_open == 1) {
+           game.ghosts[i].direction = DOWN;
+           direction_to_center_set = TRUE;
+          }
+          /* stay around cell (4,3) if center was not open */
+          if (cell_nr_x == 4 && cell_nr_y == 3 && direction_to_center_set == FALSE) {
+             if (game.ghosts[i].direction == LEFT && left_open == 1)   game.ghosts[i].direction = LEFT;   // continue left
+             else if (game.ghosts[i].direction == LEFT && left_open == 0 && up_open == 1)   game.ghosts[i].direction = UP;   // NEW
+             else if (game.ghosts[i].direction == LEFT && left_open == 0 && up_open == 0)   game.ghosts[i].direction = RIGHT;   // NEW
+             else if (game.ghosts[i].direction == RIGHT && right_open == 1) game.ghosts[i].direction = RIGHT;  // continue right
+             else if (game.ghosts[i].direction == RIGHT && right_open == 0 && up_open == 1) game.ghosts[i].direction = UP;  // NEW
+             else if (game.ghosts[i].direction == RIGHT && right_open == 0 && up_open == 0) game.ghosts[i].direction = LEFT;  // NEW
+             else if (game.ghosts[i].direction == DOWN && left_open == 1)   game.ghosts[i].direction = LEFT; 
+             else if (game.ghosts[i].direction == DOWN && left_open == 0 && right_open == 1) 
+                   game.ghosts[i].direction = RIGHT; 
+             else if (game.ghosts[i].direction == DOWN && left_open == 0 && right_open == 0) 
+                   game.ghosts[i].direction = UP;  // go back
+
+             direction_to_center_set = TRUE;
+          }
 
-             /* check movement to center when at cell (4,3) */
-             if (cell_nr_x == 4 && cell_nr_y == 3 && down_open == 1) {
-              ghosts[i].direction = DOWN;
-              direction_to_center_set = TRUE;
-             }
-             /* stay around cell (4,3) if center was not open */
-             if (cell_nr_x == 4 && cell_nr_y == 3 && direction_to_center_set == FALSE) {
-                if (ghosts[i].direction == LEFT && left_open == 1)   ghosts[i].direction = LEFT;   // continue left
-                else if (ghosts[i].direction == LEFT && left_open == 0 && up_open == 1)   ghosts[i].direction = UP;   // NEW
-                else if (ghosts[i].direction == LEFT && left_open == 0 && up_open == 0)   ghosts[i].direction = RIGHT;   // NEW
-                else if (ghosts[i].direction == RIGHT && right_open == 1) ghosts[i].direction = RIGHT;  // continue right
-                else if (ghosts[i].direction == RIGHT && right_open == 0 && up_open == 1) ghosts[i].direction = UP;  // NEW
-                else if (ghosts[i].direction == RIGHT && right_open == 0 && up_open == 0) ghosts[i].direction = LEFT;  // NEW
-                else if (ghosts[i].direction == DOWN && left_open == 1)   ghosts[i].direction = LEFT; 
-                else if (ghosts[i].direction == DOWN && left_open == 0 && right_open == 1) 
-                      ghosts[i].direction = RIGHT; 
-                else if (ghosts[i].direction == DOWN && left_open == 0 && right_open == 0) 
-                      ghosts[i].direction = UP;  // go back
-
-                direction_to_center_set = TRUE;
-             }
+          /* check movement to center when at cell (4,5) */
+          if (cell_nr_x == 4 && cell_nr_y == 5 && up_open == 1) {
+           game.ghosts[i].direction = UP;
+           direction_to_center_set = TRUE;
+          }
+          /* stay around cell (4,5) if center was not open */
+          if (cell_nr_x == 4 && cell_nr_y == 5 && direction_to_center_set == FALSE) {
+             if (game.ghosts[i].direction == LEFT && left_open == 1)   game.ghosts[i].direction = LEFT;   // continue left
+             else if (game.ghosts[i].direction == LEFT && left_open == 0 && down_open == 1)   game.ghosts[i].direction = DOWN;   // NEW
+             else if (game.ghosts[i].direction == LEFT && left_open == 0 && down_open == 0)   game.ghosts[i].direction = RIGHT;   // NEW                
+             else if (game.ghosts[i].direction == RIGHT && right_open == 1) game.ghosts[i].direction = RIGHT;  // continue right
+             else if (game.ghosts[i].direction == RIGHT && right_open == 0 && down_open == 1) game.ghosts[i].direction = DOWN;  // NEW
+             else if (game.ghosts[i].direction == RIGHT && right_open == 0 && down_open == 0) game.ghosts[i].direction = LEFT;  // NEW
+             else if (game.ghosts[i].direction == UP && left_open == 1)     game.ghosts[i].direction = LEFT; 
+             else if (game.ghosts[i].direction == UP && left_open == 0 && right_open == 1) 
+                   game.ghosts[i].direction = RIGHT; 
+             else if (game.ghosts[i].direction == UP && left_open == 0 && right_open == 0) 
+                   game.ghosts[i].direction = DOWN;  // go back
+             direction_to_center_set = TRUE;
+          }
+        }
+  } 
+
+  // chasers follow the flow field, until it reaches this cell they move at random
+  if (direction_to_center_set == FALSE && game.ghosts[i].status == GHOST_NORMAL && game.ghosts_chasing == TRUE && i < game.num_chasers) {
+     found = flow_direction(cell, exits, game.ghosts[i].direction, FALSE);
+     if (found != 0) {
+        game.ghosts[i].direction = found;
+        direction_to_center_set = TRUE;     // skip the random choice below
+     }
+  }
 
-             /* check movement to center when at cell (4,5) */
-             if (cell_nr_x == 4 && cell_nr_y == 5 && up_open == 1) {
-              ghosts[i].direction = UP;
-              direction_to_center_set = TRUE;
-             }
-             /* stay around cell (4,5) if center was not open */
-             if (cell_nr_x == 4 && cell_nr_y == 5 && direction_to_center_set == FALSE) {
-                if (ghosts[i].direction == LEFT && left_open == 1)   ghosts[i].direction = LEFT;   // continue left
-                else if (ghosts[i].direction == LEFT && left_open == 0 && down_open == 1)   ghosts[i].direction = DOWN;   // NEW
-                else if (ghosts[i].direction == LEFT && left_open == 0 && down_open == 0)   ghosts[i].direction = RIGHT;   // NEW                
-                else if (ghosts[i].direction == RIGHT && right_open == 1) ghosts[i].direction = RIGHT;  // continue right
-                else if (ghosts[i].direction == RIGHT && right_open == 0 && down_open == 1) ghosts[i].direction = DOWN;  // NEW
-                else if (ghosts[i].direction == RIGHT && right_open == 0 && down_open == 0) ghosts[i].direction = LEFT;  // NEW
-                else if (ghosts[i].direction == UP && left_open == 1)     ghosts[i].direction = LEFT; 
-                else if (ghosts[i].direction == UP && left_open == 0 && right_open == 1) 
-                      ghosts[i].direction = RIGHT; 
-                else if (ghosts[i].direction == UP && left_open == 0 && right_open == 0) 
-                      ghosts[i].direction = DOWN;  // go back
-                direction_to_center_set = TRUE;
-             }
-           }
-     } 
-
-     if (ghosts[i].status == 4) {  // recharging
-             ghosts[i].recharge_timer --;
-             if (ghosts[i].recharge_timer == -1) {
-                 //printf("Ghost %d recharged, become normal\n",i);
-                 get_ink_colour(ghosts[i].colour);
-                 sp1_IterateSprChar(ghosts[i].sprite, add_colour_to_sprite);
-
-                 ghosts[i].status = 1;
-                 ghosts[i].recharge_timer = 0;
-                 ghosts[i].direction = DOWN;    // but others directions are possible later on
-             }
-      }      
+  if (direction_to_center_set == FALSE) {   // direction not already set for eaten ghost
 
-     if (direction_to_center_set == FALSE) {   // direction not already set for status = 3
+       switch (game.ghosts[i].direction) {
 
-          switch (ghosts[i].direction) {
+       case LEFT:  
+          // continue left (50% chance, else go up or down)
+          //    if not, go right back (return)
+          if (left_open == 1 && (up_open == 1 || down_open == 1) && ((rand()%10 >= 5) )) {
+             game.ghosts[i].direction = LEFT;
+          } else {
+                   if (up_open == 1 || down_open == 1 ) {
+                      found = 0;
+                      while (found == 0) {  // go up or down, if possible
+                          if (rand()%2 == 0 && up_open == 1) {
+                              found = 1;
+                              game.ghosts[i].direction = UP;
+                          } else { 
+                                   if (down_open == 1) {
+                                       found = 1;      
+                                       game.ghosts[i].direction = DOWN;
+                                   }
+                          }
+                      }  // end while
+                    } else { 
+                            if (left_open == 1) {
+                                game.ghosts[i].direction = LEFT;
+                            } else {    
+                                game.ghosts[i].direction = RIGHT;
+                            } 
+                    }
+          }                 
+        break;
 
-          case LEFT:  
-             // continue left (50% chance, else go up or down)
-             //    if not, go right back (return)
-             if (left_open == 1 && (up_open == 1 || down_open == 1) && ((rand()%10 >= 5) )) {
-                ghosts[i].direction = LEFT;
-             } else {
-                      if (up_open == 1 || down_open == 1 ) {
-                         found = 0;
-                         while (found == 0) {  // go up or down, if possible
-                             if (rand()%2 == 0 && up_open == 1) {
-                                 found = 1;
-                                 ghosts[i].direction = UP;
-                             } else { 
-                                      if (down_open == 1) {
-                                          found = 1;      
-                                          ghosts[i].direction = DOWN;
-                                      }
-                             }
-                         }  // end while
-                       } else { 
-                               if (left_open == 1) {
-                                   ghosts[i].direction = LEFT;
-                               } else {    
-                                   ghosts[i].direction = RIGHT;
-                               } 
-                       }
-             }                 
-           break;
+      case RIGHT: 
+          // continue right (50% chance, else go up or down)
+          //    if not, go left back (return)
+          if (right_open == 1 && (up_open == 1 || down_open == 1) && ((rand()%10 >= 5) )) {
+             game.ghosts[i].direction = RIGHT;
+          } else {
+                   if (up_open == 1 || down_open == 1 ) {
+                      found = 0;
+                      while (found == 0) {  // go up or down, if possible
+                          if (rand()%2 == 0 && up_open == 1) {
+                              found = 1;
+                              game.ghosts[i].direction = UP;
+                          } else { 
+                                   if (down_open == 1) {
+                                       found = 1;      
+                                       game.ghosts[i].direction = DOWN;
+                                   }
+                          }
+                      }  // end while
+                    } else { 
+                            if (right_open == 1) {
+                                game.ghosts[i].direction = RIGHT;
+                            } else {    
+                                game.ghosts[i].direction = LEFT;
+                            } 
+                    }
+          }                 
+        break;
 
-         case RIGHT: 
-             // continue right (50% chance, else go up or down)
-             //    if not, go left back (return)
-             if (right_open == 1 && (up_open == 1 || down_open == 1) && ((rand()%10 >= 5) )) {
-                ghosts[i].direction = RIGHT;
-             } else {
-                      if (up_open == 1 || down_open == 1 ) {
-                         found = 0;
-                         while (found == 0) {  // go up or down, if possible
-                             if (rand()%2 == 0 && up_open == 1) {
-                                 found = 1;
-                                 ghosts[i].direction = UP;
-                             } else { 
-                                      if (down_open == 1) {
-                                          found = 1;      
-                                          ghosts[i].direction = DOWN;
-                                      }
-                             }
-                         }  // end while
-                       } else { 
-                               if (right_open == 1) {
-                                   ghosts[i].direction = RIGHT;
-                               } else {    
-                                   ghosts[i].direction = LEFT;
-                               } 
-                       }
-             }                 
-           break;
+      case UP:
+          // continue up (50% chance, else go left or right)
+          //    if not, go right down (return)
+          if (up_open == 1 && (left_open == 1 || right_open == 1) && ((rand()%10 >= 5) )) {
+             game.ghosts[i].direction = UP;
+          } else {
+                   if (left_open == 1 || right_open == 1 ) {
+                      found = 0;
+                      while (found == 0) {  // go left or right, if possible
+                          if (rand()%2 == 0 && left_open == 1) {
+                              found = 1;
+                              game.ghosts[i].direction = LEFT;
+                          } else { 
+                                   if (right_open == 1) {
+                                       found = 1;      
+                                       game.ghosts[i].direction = RIGHT;
+                                   }
+                          }
+                      }  // end while
+                    } else { 
+                            if (up_open == 1) {
+                                game.ghosts[i].direction = UP;
+                            } else {    
+                                game.ghosts[i].direction = DOWN;
+                            } 
+                    }
+          }                 
+        break;
 
-         case UP:
-             // continue up (50% chance, else go left or right)
-             //    if not, go right down (return)
-             if (up_open == 1 && (left_open == 1 || right_open == 1) && ((rand()%10 >= 5) )) {
-                ghosts[i].direction = UP;
-             } else {
-                      if (left_open == 1 || right_open == 1 ) {
-                         found = 0;
-                         while (found == 0) {  // go left or right, if possible
-                             if (rand()%2 == 0 && left_open == 1) {
-                                 found = 1;
-                                 ghosts[i].direction = LEFT;
-                             } else { 
-                                      if (right_open == 1) {
-                                          found = 1;      
-                                          ghosts[i].direction = RIGHT;
-                                      }
-                             }
-                         }  // end while
-                       } else { 
-                               if (up_open == 1) {
-                                   ghosts[i].direction = UP;
-                               } else {    
-                                   ghosts[i].direction = DOWN;
-                               } 
-                       }
-             }                 
-           break;
+      case DOWN: 
+          // continue down (50% chance, else go left or right)
+          //    if not, go right up (return)
+          if (down_open == 1 && (left_open == 1 || right_open == 1) && ((rand()%10 >= 5) )) {
+             game.ghosts[i].direction = DOWN;
+          } else {
+                   if (left_open == 1 || right_open == 1 ) {
+                      found = 0;
+                      while (found == 0) {  // go left or right, if possible
+                          if (rand()%2 == 0 && left_open == 1) {
+                              found = 1;
+                              game.ghosts[i].direction = LEFT;
+                          } else { 
+                                   if (right_open == 1) {
+                                       found = 1;      
+                                       game.ghosts[i].direction = RIGHT;
+                                   }
+                          }
+                      }  // end while
+                    } else { 
+                            if (down_open == 1) {
+                                game.ghosts[i].direction = DOWN;
+                            } else {    
+                                game.ghosts[i].direction = UP;
+                            } 
+                    }
+          }                 
+        break;
+      }   // end switch( direction )
+  }       // end directiion_to_center_set     
 
-         case DOWN: 
-             // continue down (50% chance, else go left or right)
-             //    if not, go right up (return)
-             if (down_open == 1 && (left_open == 1 || right_open == 1) && ((rand()%10 >= 5) )) {
-                ghosts[i].direction = DOWN;
-             } else {
-                      if (left_open == 1 || right_open == 1 ) {
-                         found = 0;
-                         while (found == 0) {  // go left or right, if possible
-                             if (rand()%2 == 0 && left_open == 1) {
-                                 found = 1;
-                                 ghosts[i].direction = LEFT;
-                             } else { 
-                                      if (right_open == 1) {
-                                          found = 1;      
-                                          ghosts[i].direction = RIGHT;
-                                      }
-                             }
-                         }  // end while
-                       } else { 
-                               if (down_open == 1) {
-                                   ghosts[i].direction = DOWN;
-                               } else {    
-                                   ghosts[i].direction = UP;
-                               } 
-                       }
-             }                 
-           break;
-         }   // end switch( direction )
-     }       // end directiion_to_center_set     
-  }          // if middle of cell
+  game.ghosts[i].countdown = edge_length(cell, game.ghosts[i].direction);
+}
+
+
+void set_ghost_state(unsigned char i, unsigned char state)
+{
+  game.ghosts[i].status = state;
+  game.ghosts[i].speed  = ghost_states[state].speed;
+  game.ghosts[i].timer  = ghost_states[state].timer;
+
+  if (ghost_states[state].move == MOVE_WAIT) game.ghosts[i].direction = 0;    // stand still
+     else if (game.ghosts[i].direction == 0) game.ghosts[i].direction = DOWN;      // leave the center
+                                                                         // (other directions are possible later on)
+  get_ghost_ink(i);
+  sp1_IterateSprChar(game.ghosts[i].sprite, add_colour_to_sprite);
+}
+
+
+void get_ghost_ink(unsigned char i)
+{
+  // ink_colour is a global variable
+  if (ghost_states[game.ghosts[i].status].ink == 0) get_ink_colour(game.ghosts[i].colour);
+     else ink_colour = ghost_states[game.ghosts[i].status].ink;
 }
 
 
@@ -1408,42 +2268,38 @@ void check_ghosts_hits_munchkin(void)
 {
   unsigned char a_x, a_y, a_xr, a_yb;   // top-left and bottom-right coordinates of ghost
   
-  if (munchkin_dying == FALSE) {
+  if (game.munchkin_dying == FALSE) {
      /* check if munchkin collides with a ghost while ghosts is active or can be eaten */
      
      /* loop active ghosts */
      for (i = 0; i < NUM_GHOSTS; i++)
      {
-       if (ghosts[i].status == 1 || ghosts[i].status == 2) {
-          a_xr = (ghosts[i].x + 8) ;   // width  factor pixel
-          a_yb = (ghosts[i].y + 8) ;   // height factor pixel
-          a_x  = ghosts[i].x;
-          a_y  = ghosts[i].y;
-
-          if ( munchkin_x_factor1 + 6          > a_x   &&
-               munchkin_x_factor1 + 2          < a_xr  &&
-               munchkin_y_factor1 + 6          > a_y   &&
-               munchkin_y_factor1 + 2          < a_yb) {
-
-               if (ghosts[i].status == 1) {
+       if (ghost_states[game.ghosts[i].status].hit != HIT_NONE) {
+          a_xr = (game.ghosts[i].x + 8) ;   // width  factor pixel
+          a_yb = (game.ghosts[i].y + 8) ;   // height factor pixel
+          a_x  = game.ghosts[i].x;
+          a_y  = game.ghosts[i].y;
+
+          if ( game.munchkin_x_factor1 + 6          > a_x   &&
+               game.munchkin_x_factor1 + 2          < a_xr  &&
+               game.munchkin_y_factor1 + 6          > a_y   &&
+               game.munchkin_y_factor1 + 2          < a_yb) {
+
+               if (ghost_states[game.ghosts[i].status].hit == HIT_KILLS) {
                      //printf("%d - DEADLY COLLISION!\n", frame);
-                     munchkin_dying = TRUE;
-                     munchkin_dying_animation = 1;
-               } else {   // ghost has status 2 and can be eaten
-                      // change color to white
-                     ink_colour = INK_WHITE | PAPER_BLACK;      
-                     sp1_IterateSprChar(ghosts[i].sprite, add_colour_to_sprite);
-
-                     ghosts[i].status = 3;
-                     score = score + 10;
-                     ghosts[i].gulp_sound_delay = 5;  // postpone sound a little
-                     if (score > high_score) {
-                         high_score = score;
+                     game.munchkin_dying = TRUE;
+                     anim_start(&game.munchkin_anim, munchkin_dying_anim);
+               } else {   // HIT_EATEN, ghost can be eaten
+                     set_ghost_state(i, ghost_states[game.ghosts[i].status].on_hit);   // white
+                     game.score = game.score + 10;
+                     game.ghosts[i].gulp_sound_delay = 5;  // postpone sound a little
+                     if (game.score > high_score) {
+                         high_score = game.score;
                      }
                      display_score();    
                }  
           }
-     } // end status = 1 or 2
+     } // end ghost can hit
     }  // end loop active ghosts
   }    // munchkin_dying = FALSE
    ;
@@ -1455,135 +2311,386 @@ void setup_pills(void)
   // delete any inactive pill-sprites (e.g. when level not completed)
   // (pill status initialized in setup()
   for (i = 0; i < NUM_PILLS; i++) {
-    if (pills[i].status != 0) {
-          sp1_MoveSprAbs(pills[i].sprite, &cr, NULL, 0, 34, 0, 0);  // remove from screen
-                                                                    // print at column 34
-          sp1_DeleteSpr(pills[i].sprite);
-          pills[i].status = 0;   
+    if (game.pills[i].status != 0) {
+          delete_pill_sprite(i);
+          game.pills[i].status = 0;   
      }      
+     game.pills[i].countdown = 0;     // choose a direction on the first move
   }
 
   // top-left
   if (NUM_PILLS >= 1) {
-     pills[0].x = (MAZE_OFFSET_X  + 12       );   // 12 + 0*24
-     pills[0].y = (MAZE_OFFSET_Y + 8       );     //  8 + 0*16
-     pills[0].direction = 4;                
-     pills[0].status = 2;        // powerpill
+     game.pills[0].x = (MAZE_OFFSET_X  + 12       );   // 12 + 0*24
+     game.pills[0].y = (MAZE_OFFSET_Y + 8       );     //  8 + 0*16
+     game.pills[0].direction = 4;                
+     game.pills[0].status = 2;        // powerpill
   }   
   if (NUM_PILLS >= 2) {
-     pills[1].x = (MAZE_OFFSET_X  + 36       );   // 12 + 1*24
-     pills[1].y = (MAZE_OFFSET_Y + 8       );     //   8 + 0*16
-     pills[1].direction = 1;                
-     pills[1].status = 1;     
+     game.pills[1].x = (MAZE_OFFSET_X  + 36       );   // 12 + 1*24
+     game.pills[1].y = (MAZE_OFFSET_Y + 8       );     //   8 + 0*16
+     game.pills[1].direction = 1;                
+     game.pills[1].status = 1;     
   }   
   if (NUM_PILLS >= 3) {
-     pills[2].x = (MAZE_OFFSET_X  + 12       );   // etc
-     pills[2].y = (MAZE_OFFSET_Y + 24      );
-     pills[2].direction = 2;                
-     pills[2].status = 1;     
+     game.pills[2].x = (MAZE_OFFSET_X  + 12       );   // etc
+     game.pills[2].y = (MAZE_OFFSET_Y + 24      );
+     game.pills[2].direction = 2;                
+     game.pills[2].status = 1;     
   }   
   // top-right
   if (NUM_PILLS >= 4) {
-     pills[3].x = (MAZE_OFFSET_X  + 180      );
-     pills[3].y = (MAZE_OFFSET_Y + 8       );
-     pills[3].direction = 1;                
-     pills[3].status = 1;     
+     game.pills[3].x = (MAZE_OFFSET_X  + 180      );
+     game.pills[3].y = (MAZE_OFFSET_Y + 8       );
+     game.pills[3].direction = 1;                
+     game.pills[3].status = 1;     
   }   
   if (NUM_PILLS >= 5) {
-     pills[4].x = (MAZE_OFFSET_X  + 204      );
-     pills[4].y = (MAZE_OFFSET_Y + 8       );
-     pills[4].direction = 4;                
-     pills[4].status = 2;        // powerpill
+     game.pills[4].x = (MAZE_OFFSET_X  + 204      );
+     game.pills[4].y = (MAZE_OFFSET_Y + 8       );
+     game.pills[4].direction = 4;                
+     game.pills[4].status = 2;        // powerpill
   }   
   if (NUM_PILLS >= 6) {
-     pills[5].x = (MAZE_OFFSET_X  + 204  );
-     pills[5].y = (MAZE_OFFSET_Y + 24      );
-     pills[5].direction = 1;                
-     pills[5].status = 1;     
+     game.pills[5].x = (MAZE_OFFSET_X  + 204  );
+     game.pills[5].y = (MAZE_OFFSET_Y + 24      );
+     game.pills[5].direction = 1;                
+     game.pills[5].status = 1;     
   }   
   // bottom-left
   if (NUM_PILLS >= 7) {
-     pills[6].x = (MAZE_OFFSET_X  + 12       );
-     pills[6].y = (MAZE_OFFSET_Y + 88      );
-     pills[6].direction = 2;                
-     pills[6].status = 1;     
+     game.pills[6].x = (MAZE_OFFSET_X  + 12       );
+     game.pills[6].y = (MAZE_OFFSET_Y + 88      );
+     game.pills[6].direction = 2;                
+     game.pills[6].status = 1;     
   }   
   if (NUM_PILLS >= 8) {
-     pills[7].x = (MAZE_OFFSET_X  + 12       );
-     pills[7].y = (MAZE_OFFSET_Y + 104    );
-     pills[7].direction = 3;                
-     pills[7].status = 2;       // powerpill
+     game.pills[7].x = (MAZE_OFFSET_X  + 12       );
+     game.pills[7].y = (MAZE_OFFSET_Y + 104    );
+     game.pills[7].direction = 3;                
+     game.pills[7].status = 2;       // powerpill
   }   
   if (NUM_PILLS >= 9) {
-     pills[8].x = (MAZE_OFFSET_X  + 36       );
-     pills[8].y = (MAZE_OFFSET_Y + 104     );
-     pills[8].direction = 2;                
-     pills[8].status = 1;     
+     game.pills[8].x = (MAZE_OFFSET_X  + 36       );
+     game.pills[8].y = (MAZE_OFFSET_Y + 104     );
+     game.pills[8].direction = 2;                
+     game.pills[8].status = 1;     
   }   
   // bottom-right
   if (NUM_PILLS >= 10) {
-     pills[9].x = (MAZE_OFFSET_X  + 204      );
-     pills[9].y = (MAZE_OFFSET_Y + 88      );
-     pills[9].direction = 1;                
-     pills[9].status = 1;     
+     game.pills[9].x = (MAZE_OFFSET_X  + 204      );
+     game.pills[9].y = (MAZE_OFFSET_Y + 88      );
+     game.pills[9].direction = 1;                
+     game.pills[9].status = 1;     
   }   
   if (NUM_PILLS >= 11) {
-     pills[10].x = (MAZE_OFFSET_X  + 180      );
-     pills[10].y = (MAZE_OFFSET_Y + 104     );
-     pills[10].direction = 1;                
-     pills[10].status = 1;     
+     game.pills[10].x = (MAZE_OFFSET_X  + 180      );
+     game.pills[10].y = (MAZE_OFFSET_Y + 104     );
+     game.pills[10].direction = 1;                
+     game.pills[10].status = 1;     
   }   
   if (NUM_PILLS >= 12) {
-     pills[11].x = (MAZE_OFFSET_X  + 204      );
-     pills[11].y = (MAZE_OFFSET_Y + 104    );
-     pills[11].direction = 3;                
-     pills[11].status = 2;       // powerpill
+     game.pills[11].x = (MAZE_OFFSET_X  + 204      );
+     game.pills[11].y = (MAZE_OFFSET_Y + 104    );
+     game.pills[11].direction = 3;                
+     game.pills[11].status = 2;       // powerpill
   }   
 
   if (NUM_PILLS >= 13) {  // spread the rest of the pills random across to entire maze 
     for (i = 12; i < NUM_PILLS; i++) {
-      pills[i].x = (MAZE_OFFSET_X  + 7 + ( rand()%8 ) *24);  //random cell x between 0 and 8
-      pills[i].y = (MAZE_OFFSET_Y + 4 + ( rand()%6 ) *16);  //random cell x between 0 and 8
-      pills[i].status = 1; 
-      pills[i].direction = 2;    // must have value for choose_pill_direction
+      // (must be the middle of a cell, that is where choose_pill_direction expects them)
+      game.pills[i].x = (MAZE_OFFSET_X  + 12 + ( rand()%8 ) *24);  //random cell x between 0 and 8
+      game.pills[i].y = (MAZE_OFFSET_Y +  8 + ( rand()%6 ) *16);  //random cell x between 0 and 8
+      game.pills[i].status = 1; 
+      game.pills[i].direction = 2;    // must have value for choose_pill_direction
       choose_pill_direction(i);
     }
   }
   
   for (i = 0; i < NUM_PILLS; i++) {
-      pills[i].speed = 1;   // initial speed
-      pills[i].sprite = sp1_CreateSpr(SP1_DRAW_MASK2LB, SP1_TYPE_2BYTE, 2, 0, i+10);
-                                                                            // ^ on lower plane
-      sp1_AddColSpr(pills[i].sprite, SP1_DRAW_MASK2RB, SP1_TYPE_2BYTE, 0, 0);
-      
-      ink_colour = INK_WHITE | PAPER_BLACK;
-      sp1_IterateSprChar(pills[i].sprite, add_colour_to_sprite);
-      pills[i].colour_masked = FALSE;   // normal white
+      game.pills[i].speed = 1;   // initial speed
+      create_pill_sprite(i);
   }
 }
 
 
+void create_pill_sprite(unsigned char i)
+{
+#ifdef PILL_LAYER
+  pill_layer[i].image = PILL_OFF;
+#elif defined(PRESHIFT_PILLS)
+  game.pills[i].sprite = sp1_CreateSpr(SP1_DRAW_MASK2NR, SP1_TYPE_2BYTE, 2, 0, i+10);
+  sp1_AddColSpr(game.pills[i].sprite, SP1_DRAW_MASK2NR, SP1_TYPE_2BYTE, PRESHIFT_COLUMN, 0);
+#else
+  game.pills[i].sprite = sp1_CreateSpr(SP1_DRAW_MASK2LB, SP1_TYPE_2BYTE, 2, 0, i+10);
+                                                                          // ^ on lower plane
+  sp1_AddColSpr(game.pills[i].sprite, SP1_DRAW_MASK2RB, SP1_TYPE_2BYTE, 0, 0);
+#endif
+
+#if SPRITE_BUDGET && !defined(PILL_LAYER)
+  pill_drawn[i].image = PILL_OFF;        // not on the screen yet
+#endif
+
+  ink_colour = INK_WHITE | PAPER_BLACK;
+  set_pill_ink(i);
+  game.pills[i].colour_masked = FALSE;   // normal white
+}
+
+
+void delete_pill_sprite(unsigned char i)
+{
+#ifdef PILL_LAYER
+  leave_pill_cells(i);              // off the screen straight away, as a sprite
+  compose_pill_cells();
+  pill_layer[i].image = PILL_OFF;
+#else
+  sp1_MoveSprAbs(game.pills[i].sprite, &cr, NULL, 0, 34, 0, 0);  // remove from screen
+                                                              // print at column 34
+  sp1_DeleteSpr(game.pills[i].sprite);
+#endif
+}
+
+
+// colour of a pill: ink_colour
+void set_pill_ink(unsigned char i)
+{
+#ifdef PILL_LAYER
+  pill_layer[i].ink = ink_colour;
+  pill_layer[i].dirty = TRUE;
+#else
+  sp1_IterateSprChar(game.pills[i].sprite, add_colour_to_sprite);
+#endif
+}
+
+
+#ifdef PILL_LAYER
+
+// every cell of the layer free (setup())
+void setup_pill_layer(void)
+{
+  unsigned char n;
+
+  for (n = 0; n < PILL_CELLS; n++) free_cells[n] = n;
+  num_free_cells = PILL_CELLS;
+}
+
+
+// a cell to compose again in this draw_pills()
+void compose_cell(pill_cell_type *c)
+{
+  if (c->compose == FALSE) {
+     c->compose = TRUE;
+     compose_cells[num_compose_cells++] = c;
+  }
+}
+
+
+// pill i out of its cells
+void leave_pill_cells(unsigned char i)
+{
+  pill_cell_type *c;
+  unsigned char k;
+
+  for (k = 0; k < PILL_CHARS && (c = pill_layer[i].cells[k]) != NULL; ++k) {
+     c->pills--;
+     compose_cell(c);
+     pill_layer[i].cells[k] = NULL;
+  }
+}
+
+
+// cell of the pill layer at row, col (NULL: off screen). enter == TRUE puts pill i in it
+// (a free cell if there is none there yet), otherwise it is a cell pill i is in, which
+// gets its ink when it is composed (NULL: printed over since, no cell of the layer)
+pill_cell_type *pill_cell(unsigned char i, unsigned char row, unsigned char col, unsigned char enter)
+{
+  struct sp1_update *u;
+  pill_cell_type *c;
+  unsigned char k;
+
+  if (row > 23 || col > 31) return NULL;
+  u = sp1_GetUpdateStruct(row, col);
+  c = (pill_cell_type *)u->tile;     // a cell of the layer already?
+
+  if (c < pill_cells || c >= pill_cells + PILL_CELLS) {
+     if (enter == FALSE) return NULL;  // a tile code or udg, not a pill_cell_type
+     c = pill_cells + free_cells[--num_free_cells];   // never runs out, see PILL_CELLS
+     c->update = u;
+     c->tile = u->tile;
+     c->colour = u->colour;
+     u->tile = (unsigned int)c->graphic;
+  } else if (enter == FALSE) {
+     if (c->compose == TRUE) u->colour = (c->colour & SP1_AMASK_INK) | pill_layer[i].ink;   // as add_colour_to_sprite() does
+     return c;
+  }
+  c->pills++;
+  compose_cell(c);
+  for (k = 0; pill_layer[i].cells[k] != NULL; ++k) ;
+  pill_layer[i].cells[k] = c;
+  return c;
+}
+
+
+// a pill frame (8 rows of mask, graphic) at the pill's position: enter == TRUE puts the
+// pill in the cells it covers, otherwise it is drawn into the ones being composed
+void draw_pill_layer(unsigned char i, unsigned char *graphic, unsigned char enter)
+{
+  unsigned char r, py, row, col, m, g;
+  unsigned int mask, pixels;        // 2 bytes: left and right cell, mask inverted
+  pill_cell_type *cell[2];
+
+  row = 0xff;
+  col = game.pills[i].x >> 3;
+  for (r = 0; r < 8 * 2; r += 2) {
+     if (graphic[r] == 0xff && graphic[r + 1] == 0x00) continue;    // blank row
+
+     py = game.pills[i].y + r / 2;
+     if (py >> 3 != row) {
+        row = py >> 3;
+        cell[0] = cell[1] = NULL;
+     }
+     mask = ((unsigned int)(graphic[r] ^ 0xff) << 8) >> (game.pills[i].x & 7);
+     pixels = ((unsigned int)graphic[r + 1] << 8) >> (game.pills[i].x & 7);
+
+     m = (mask >> 8) ^ 0xff;
+     g = pixels >> 8;
+     if (m != 0xff || g != 0x00) {
+        if (cell[0] == NULL) cell[0] = pill_cell(i, row, col, enter);
+        if (cell[0] != NULL && enter == FALSE && cell[0]->compose == TRUE)
+           cell[0]->graphic[py & 7] = (cell[0]->graphic[py & 7] & m) | g;
+     }
+     m = (mask & 0xff) ^ 0xff;
+     g = pixels & 0xff;
+     if (m != 0xff || g != 0x00) {
+        if (cell[1] == NULL) cell[1] = pill_cell(i, row, col + 1, enter);
+        if (cell[1] != NULL && enter == FALSE && cell[1]->compose == TRUE)
+           cell[1]->graphic[py & 7] = (cell[1]->graphic[py & 7] & m) | g;
+     }
+  }
+}
+
+
+// the cells in compose_cells[] from their own tile again with all pills in them, in pill
+// order as when every pill is drawn again. A cell without pills gets its tile and colour
+// back (not if printed over since: maze rotation, print_maze) and is free again.
+void compose_pill_cells(void)
+{
+  pill_cell_type **p, *c;
+  struct sp1_update *u;
+  unsigned char *tile;
+  unsigned char n, k;             // not i: also called from delete_pill_sprite() in loops over i
+
+  for (p = compose_cells; p < compose_cells + num_compose_cells; ++p) {
+     c = *p;
+     u = c->update;
+     if (c->pills != 0) {
+        if (c->tile < 256) tile = (unsigned char *)(SP1_TILE_ARRAY[c->tile] | SP1_TILE_ARRAY[c->tile + 256] << 8);
+           else tile = (unsigned char *)c->tile;
+        memcpy(c->graphic, tile, 8);
+        u->colour = c->colour;
+        sp1_InvUpdateStruct(u);
+     } else {
+        if (u->tile == (unsigned int)c->graphic) {
+           u->tile = c->tile;
+           u->colour = c->colour;
+           sp1_InvUpdateStruct(u);
+        }
+        free_cells[num_free_cells++] = c - pill_cells;
+     }
+  }
+
+  for (n = 0; n < NUM_PILLS; n++) {
+     if (pill_layer[n].image == PILL_OFF) continue;
+     for (k = 0; k < PILL_CHARS && (c = pill_layer[n].cells[k]) != NULL; ++k) {
+        if (c->compose == TRUE) {
+           draw_pill_layer(n, pill_sprite_graphic[pill_layer[n].image].graphic, FALSE);
+           break;
+        }
+     }
+  }
+
+  for (p = compose_cells; p < compose_cells + num_compose_cells; ++p) (*p)->compose = FALSE;
+  num_compose_cells = 0;
+}
+
+#endif
+
+
 void draw_pills(void)
 {
-  for (i = 0; i < NUM_PILLS; i++)
+#ifdef PILL_LAYER
+  unsigned char image, k, moved;
+  pill_cell_type *c;
+
+  // the pills that moved or changed (or were printed over) leave their cells
+  moved = FALSE;
+  for (i = 0; i < NUM_PILLS; i++) {
+    image = pill_image(i);
+    if (pill_layer[i].image != image || pill_layer[i].x != game.pills[i].x || pill_layer[i].y != game.pills[i].y) {
+       pill_layer[i].image = image;
+       pill_layer[i].x = game.pills[i].x;
+       pill_layer[i].y = game.pills[i].y;
+       pill_layer[i].dirty = TRUE;
+    }
+    for (k = 0; k < PILL_CHARS && (c = pill_layer[i].cells[k]) != NULL; ++k) {
+       if (c->update->tile != (unsigned int)c->graphic) pill_layer[i].dirty = TRUE;
+    }
+    if (pill_layer[i].dirty == TRUE) {
+       leave_pill_cells(i);
+       moved = TRUE;
+    }
+  }
+  if (moved == FALSE) return;    // same images at the same places: nothing to do
+
+  // and enter their new ones, only the cells left or entered are composed again
+  for (i = 0; i < NUM_PILLS; i++) {
+    if (pill_layer[i].dirty == TRUE) {
+       pill_layer[i].dirty = FALSE;
+       if (pill_layer[i].image != PILL_OFF) draw_pill_layer(i, pill_sprite_graphic[pill_layer[i].image].graphic, TRUE);
+    }
+  }
+  compose_pill_cells();
+#else
+  unsigned char n, image;
+
+  i = pill_turn;                      // see SPRITE_BUDGET
+  for (n = 0; n < NUM_PILLS; n++)
   {
-    if (pills[i].status != 0) {
-   
-      if (pills[i].status == 1) {
-                sp1_MoveSprPix(pills[i].sprite, &cr, pill_sprite_graphic[0].graphic, pills[i].x, pills[i].y);
-      } else {
-           if (tick % 4 == 0 ) {   // flash pill (tick in stead of frame)
-              sp1_MoveSprPix(pills[i].sprite, &cr, pill_sprite_graphic[1].graphic, pills[i].x, pills[i].y);
-           } else {
-           sp1_MoveSprPix(pills[i].sprite, &cr, pill_sprite_graphic[0].graphic, pills[i].x, pills[i].y);
-           }
+    image = pill_image(i);
+    if (image != PILL_OFF) {
+#if SPRITE_BUDGET
+      if (pill_drawn[i].image != image || pill_drawn[i].x != game.pills[i].x || pill_drawn[i].y != game.pills[i].y) {
+         if (sprite_fits() == FALSE) {
+            pill_turn = i;            // first in the next frame
+            break;
+         }
+         pill_drawn[i].image = image;
+         pill_drawn[i].x = game.pills[i].x;
+         pill_drawn[i].y = game.pills[i].y;
+         move_sprite(game.pills[i].sprite, pill_graphic(image, game.pills[i].x), game.pills[i].x, game.pills[i].y);
       }
+#else
+      move_sprite(game.pills[i].sprite, pill_graphic(image, game.pills[i].x), game.pills[i].x, game.pills[i].y);
+#endif
     }   // if pill alive
-   }     // for loop
+    if (++i == NUM_PILLS) i = 0;
+  }     // for loop
+#endif
 
 }
 
 
+// image of a pill now: 0 pill, 1 flashing powerpill or PILL_OFF (eaten)
+unsigned char pill_image(unsigned char i)
+{
+  if (game.pills[i].status == 1) return 0;
+  if (game.pills[i].status == 2) {
+     if (tick % 4 == 0) return 1;     // flash pill (tick in stead of frame)
+     return 0;
+  }
+  return PILL_OFF;
+}
+
+
 void check_pill_eaten(void)
 {
   unsigned char a_x, a_y, a_xr, a_yb;       // top-left and bottom-right pill
@@ -1592,19 +2699,19 @@ void check_pill_eaten(void)
 
   // make munchkin dection area smaller to give the impression that 
   // the pill is really eaten (ie pill detecten in center of munchkin)
-  b_xr = (munchkin_x_factor1) + 4; // width factor pixel
-  b_yb = (munchkin_y_factor1) + 4; // height factor pixel
-  b_x  = (munchkin_x_factor1) + 2;
-  b_y  = (munchkin_y_factor1) + 2;
+  b_xr = (game.munchkin_x_factor1) + 4; // width factor pixel
+  b_yb = (game.munchkin_y_factor1) + 4; // height factor pixel
+  b_x  = (game.munchkin_x_factor1) + 2;
+  b_y  = (game.munchkin_y_factor1) + 2;
 
-  for (i = 0; i < NUM_PILLS && maze_completed == FALSE && munchkin_dying == FALSE; i++) {
+  for (i = 0; i < NUM_PILLS && game.maze_completed == FALSE && game.munchkin_dying == FALSE; i++) {
  
-     if (pills[i].status != 0) {   // active
+     if (game.pills[i].status != 0) {   // active
 
-        a_xr = (pills[i].x + 7);   // width  factor pixel
-        a_yb = (pills[i].y + 7);   // height factor pixel
-        a_x  = pills[i].x + 1;  // pill sprite is bigger than SDL version
-        a_y  = pills[i].y + 2;
+        a_xr = (game.pills[i].x + 7);   // width  factor pixel
+        a_yb = (game.pills[i].y + 7);   // height factor pixel
+        a_x  = game.pills[i].x + 1;  // pill sprite is bigger than SDL version
+        a_y  = game.pills[i].y + 2;
  
         /* check overlap munchkin with pill  */
         if (b_xr  > a_x   &&
@@ -1613,64 +2720,58 @@ void check_pill_eaten(void)
             b_y   < a_yb) {
               //printf("Pill %d eaten !\n", i);
               /*
-               if (munchkin_dying == FALSE) {
-                 if (pills[i].status == 1) play_sound(12,2);
+               if (game.munchkin_dying == FALSE) {
+                 if (game.pills[i].status == 1) play_sound(12,2);
                      else play_sound(14,4);
                } 
                */   
 
                /* increase score and change ghost status if powerpill */
-               if (pills[i].status == 1) { 
-                    score++;
+               if (game.pills[i].status == 1) { 
+                    game.score++;
                     display_score();
                     bit_beepfx_di(beepfx[0].effect);
                }
-               if (pills[i].status == 2) {  // powerpill
-                    score = score + 3;   
+               if (game.pills[i].status == 2) {  // powerpill
+                    game.score = game.score + 3;   
                     display_score();
                     bit_beepfx_di(beepfx[3].effect);
                     for (j = 0; j < NUM_GHOSTS; j++) {  // loop active ghosts
-                       if (ghosts[j].status == 1 || ghosts[j].status == 2) {   // can still be 2
-                            // change to magenta
-                            if (ghosts[j].status == 1) {
-                              // ghosts[j].colour = 5;  // do not change, keep original colour
-                              ink_colour = INK_MAGENTA | PAPER_BLACK;      
-                              sp1_IterateSprChar(ghosts[j].sprite, add_colour_to_sprite);
-                            }  
-                            ghosts[j].status = 2;       // ghost can be eaten now
-                            powerpill_active_timer = 90;
+                       if (ghost_states[game.ghosts[j].status].on_powerpill != 0) {   // can already be frightened
+                            // change to magenta, ghost can be eaten now
+                            if (game.ghosts[j].status != ghost_states[game.ghosts[j].status].on_powerpill)
+                              set_ghost_state(j, ghost_states[game.ghosts[j].status].on_powerpill);
+                            game.powerpill_active_timer = 90;
                        }
                     }
                 }     
 
-               if (score > high_score) {
-                    high_score = score;
+               if (game.score > high_score) {
+                    high_score = game.score;
                     display_score();
                } 
 
                // de-activate pill    
-               pills[i].status = 0;   
-               sp1_MoveSprAbs(pills[i].sprite, &cr, NULL, 0, 34, 0, 0);  // remove from screen
-                                                                       // print at column 34
-               sp1_DeleteSpr(pills[i].sprite);
+               game.pills[i].status = 0;   
+               delete_pill_sprite(i);
 
           }       // check overlap
       }           // pills[i].status != 0  active
    }              // for loop
 
-  if (maze_completed == FALSE) {
+  if (game.maze_completed == FALSE) {
     active_pills = 0;
     for (i = 0; i < NUM_PILLS; i++) {
-           if (pills[i].status != 0) {
+           if (game.pills[i].status != 0) {
                active_pills++;
                //printf("Active pills: %d\n", active_pills);
            }  
      }      
      if (active_pills == 0) {
        //printf("Maze completed\n");
-       maze_completed = TRUE;
-       maze_completed_animations = 20;  // +/-  2 seconds
-       bit_beepfx_di(beepfx[7].effect);
+       game.maze_completed = TRUE;
+       game.maze_completed_animations = 20;  // +/-  2 seconds
+       anim_start(&game.munchkin_anim, munchkin_completed_anim);   // also the sound
        //play_sound(13, 3);
      }
    }    // maze_completed == FALSE
@@ -1681,301 +2782,352 @@ void handle_pills(void)
 {
   unsigned char last_active_pill;    // nr of the last found active pill
   int cell_nr_x, cell_nr_y, cell_x_pill, cell_y_pill;
-  
-  for (i = 0; i < NUM_PILLS && maze_completed == FALSE; i++) {
-
-     if (pills[i].status != 0) {   // active
-
-             choose_pill_direction(i);
-
-             switch (pills[i].direction) {
-               case LEFT:    
-                    pills[i].x = pills[i].x - pills[i].speed;
-                    //if ( ((pills[i].x - screen_offset_x) / factor) < (MAZE_OFFSET_X - 7)) pills[i].x = (187 + MAZE_OFFSET_X) * factor + screen_offset_x ;  // wrap screen left
-                    if (pills[i].x < 8) pills[i].x = 242;  // wrap screen left                    
-                  break;
-               case RIGHT:    
-                    pills[i].x = pills[i].x + pills[i].speed;
-                    //if ( ((pills[i].x  - screen_offset_x) / factor ) > (187 + MAZE_OFFSET_X) ) pills[i].x = (MAZE_OFFSET_X - 7) * factor + screen_offset_x;  // wrap screen right
-                    if (pills[i].x > 242) pills[i].x = 8;  // wrap screen right
-                  break;
-               case UP:   
-                    pills[i].y = pills[i].y - pills[i].speed;
-                  break;
-               case DOWN:   
-                    pills[i].y = pills[i].y + pills[i].speed;
-                   break;
-              }   // end switch
+
+  // one group of pills per call (all of them without PILL_BATCHES, or the last pill)
+  if (PILL_BATCHES == 1 || game.active_pills == 1) {
+     pill_first = 0;
+     pill_step = 1;
+  } else {
+     pill_first = game.frame % PILL_BATCHES;
+     pill_step = PILL_BATCHES;
+  }
+
+  for (i = pill_first; i < NUM_PILLS && game.maze_completed == FALSE; i += pill_step) {
+
+     if (game.pills[i].status != 0) {   // active
+
+             // only decide at a node, in a corridor just follow the countdown
+             if (game.pills[i].countdown == 0) choose_pill_direction(i);
+
+             move_actor((actor_type *) &game.pills[i]);
 
 
       }           // pills[i].status != 0  active
   }               // for loop
 
-  active_pills = 0;
+  game.active_pills = 0;
   for (i = 0; i < NUM_PILLS; i++) {
-         if (pills[i].status != 0) {
-             active_pills++;
+         if (game.pills[i].status != 0) {
+             game.active_pills++;
              last_active_pill = i;
              //printf("Active pills: %d\n", active_pills);
           }   
   }        
       
   // increase speed of last pill to speed of munchkin 
-  if (active_pills == 1 && last_pill_speed_increased == FALSE) {  // increase speed only once
+  if (game.active_pills == 1 && game.last_pill_speed_increased == FALSE) {  // increase speed only once
 
-     cell_nr_x = ( (pills[last_active_pill].x) - (12 + MAZE_OFFSET_X) ) / (HORI_LINE_SIZE - 2);  
-     cell_nr_y = ( (pills[last_active_pill].y) - (8 + MAZE_OFFSET_Y) ) / (VERT_LINE_SIZE - 2);  
+     cell_nr_x = ( (game.pills[last_active_pill].x) - (12 + MAZE_OFFSET_X) ) / (HORI_LINE_SIZE - 2);  
+     cell_nr_y = ( (game.pills[last_active_pill].y) - (8 + MAZE_OFFSET_Y) ) / (VERT_LINE_SIZE - 2);  
   
      cell_x_pill = (16 + 12 + cell_nr_x * 24);
      cell_y_pill = (32 +  8 + cell_nr_y * 16);
    
-     if (cell_x_pill == pills[last_active_pill].x 
+     if (cell_x_pill == game.pills[last_active_pill].x 
          && 
-         cell_y_pill == pills[last_active_pill].y) { // last pill exactly in middle cell
+         cell_y_pill == game.pills[last_active_pill].y) { // last pill exactly in middle cell
 
-           pills[last_active_pill].speed = 2;
-           last_pill_speed_increased = TRUE;
+           game.pills[last_active_pill].speed = 2;
+           game.last_pill_speed_increased = TRUE;
      }     
   }
 }
 
 
-void check_pills_mask(void)
+// the cells of a sprite at x, y claimed in ink
+void claim_cells(unsigned char x, unsigned char y, unsigned char ink)
 {
-  unsigned char match_found;
-  match_found = FALSE;
-  
-  /* To minimize colour clash between pills and ghosts, a pill is temporarly hidden
-     when it overlaps with a ghost */
+  unsigned int cell;
+  unsigned char k;
+
+  cell = (y >> 3) * 32 + (x >> 3);
+  for (k = 0; k < SPRITE_CHARS; ++k) {
+     claims[num_claims].cell = cell + sprite_char_offset[k];
+     claims[num_claims].ink = ink;
+     if (claims[num_claims].cell < 32 * 24) {
+        claimed[claims[num_claims].cell >> 3] |= 1 << (claims[num_claims].cell & 7);
+     }
+     num_claims++;
+  }
+}
 
-  for (i = 0; i < NUM_PILLS && maze_completed == FALSE; i++) {
 
-     if (pills[i].status != 0) {  // check only active pills
+unsigned char is_claimed(unsigned int cell)
+{
+  return (cell < 32 * 24 && (claimed[cell >> 3] & (1 << (cell & 7))) != 0);
+}
 
-       match_found = FALSE;
-       for (j = 0; j < NUM_GHOSTS && match_found == FALSE ; j++) {
 
-          if (ghosts[j].status == 1 || ghosts[j].status == 2) {
+// one char of the sprite resolve_sprite() is doing, ink_colour: the ink of the sprite
+void resolve_char(unsigned int count, struct sp1_cs *c)
+{
+  unsigned int cell;
+  unsigned char ink;
+  claim_type *claim;
+
+  cell = resolve_cell + sprite_char_offset[count];
+  ink = ink_colour;
+  if (is_claimed(cell)) {
+     for (claim = claims; claim->cell != cell; ++claim) ;   // the first is in front
+     ink = claim->ink;
+     if (ink != ink_colour) resolve_masked = TRUE;
+  }
+  if (c->attr != ink) {
+     c->attr_mask = SP1_AMASK_INK;
+     c->attr = ink;
+  }
+}
 
-            // check overlap ghost and pill
-            if ( pills[i].x + 6          > ghosts[j].x - 2       &&
-                 pills[i].x             < (ghosts[j].x + 6)      &&
-                 pills[i].y + 8          > ghosts[j].y - 2       &&
-                 pills[i].y - 2          < (ghosts[j].y + 8) ) {
 
-              match_found = TRUE;
+void resolve_sprite(struct sp1_ss *s, unsigned char x, unsigned char y)
+{
+  resolve_cell = (y >> 3) * 32 + (x >> 3);
+  resolve_masked = FALSE;
+  sp1_IterateSprChar(s, resolve_char);
+}
 
-              if (pills[i].colour_masked == FALSE) {  // change colour of pill to colour of ghost to minimize colour clash
-                                                      // (if already changed, skip colour change)
-                if (ghosts[j].status == 1 ) get_ink_colour(ghosts[j].colour);
-                   else ink_colour = INK_MAGENTA | PAPER_BLACK;
-                sp1_IterateSprChar(pills[i].sprite, add_colour_to_sprite);
-                pills[i].colour_masked = TRUE;
-              }
-            }  
-       } // ghost.status 1 || 2
-     } // loop ghosts
 
-     if (match_found == FALSE && pills[i].colour_masked == TRUE) {     // back to normal white colour (if not white)
-           ink_colour = INK_WHITE | PAPER_BLACK;
-           sp1_IterateSprChar(pills[i].sprite, add_colour_to_sprite);
-           pills[i].colour_masked = FALSE;
+void resolve_colours(void)
+{
+  claim_type *claim;
+#ifndef PILL_LAYER
+  unsigned int cell;
+  unsigned char x, y;
+#endif
+  unsigned char ghosts_visible;
+
+  // the munchkin is hidden after its dying animation, the ghosts a bit earlier
+  num_claims = 0;
+  if (game.munchkin_anim.frame->image != IMAGE_HIDDEN)
+     claim_cells(game.munchkin_x_factor1, game.munchkin_y_factor1, MUNCHKIN_INK);
+  ghosts_visible = !(game.munchkin_anim.frame->flags & ANIM_NO_GHOSTS);
+
+  if (ghosts_visible) {
+     for (i = 0; i < NUM_GHOSTS; i++) {
+        if (ghost_states[game.ghosts[i].status].hit != HIT_NONE) {   // visible ghost
+           get_ghost_ink(i);
+           claim_cells(game.ghosts[i].x, game.ghosts[i].y, ink_colour);
+        }
+     }
+     // ghosts behind the munchkin (or an other ghost)
+     for (i = 0; i < NUM_GHOSTS; i++) {
+        if (ghost_states[game.ghosts[i].status].hit != HIT_NONE) {
+           get_ghost_ink(i);
+           resolve_sprite(game.ghosts[i].sprite, game.ghosts[i].x, game.ghosts[i].y);
+        }
      }
+  }
 
-    }  // pill.status != 0 
-  }    // loop pills   
+#ifndef PILL_LAYER
+  // pills behind everything; only the ones on a claimed cell or still in an other ink
+  // (the pill layer needs nothing: a sprite char is always in front of the tiles)
+  ink_colour = INK_WHITE | PAPER_BLACK;
+  for (i = 0; i < NUM_PILLS; i++) {
+     if (game.pills[i].status == 0) continue;
+#if SPRITE_BUDGET
+     if (pill_drawn[i].image == PILL_OFF) continue;
+     x = pill_drawn[i].x;
+     y = pill_drawn[i].y;
+#else
+     x = game.pills[i].x;
+     y = game.pills[i].y;
+#endif
+     cell = (y >> 3) * 32 + (x >> 3);
+     if (game.pills[i].colour_masked == TRUE ||
+         is_claimed(cell) || is_claimed(cell + 1) || is_claimed(cell + 32) || is_claimed(cell + 33)) {
+        resolve_sprite(game.pills[i].sprite, x, y);
+        game.pills[i].colour_masked = resolve_masked;
+     }
+  }
+#endif
 
+  // clear the claims for the next step
+  for (claim = claims; claim < claims + num_claims; ++claim) {
+     if (claim->cell < 32 * 24) claimed[claim->cell >> 3] = 0;
+  }
 }
 
 
 void choose_pill_direction (unsigned char i)
 {
-  int cell_nr_x, cell_nr_y, cell_x_pill, cell_y_pill;
+  int cell_nr_x, cell_nr_y;
   unsigned char left_open, right_open, up_open, down_open;     //1=open, 0=closed
   unsigned char found;
+  unsigned char cell, exits;
 
   
+  // only called when the countdown has run out, so the pill is exactly
+  // in the middle of a cell (a node, or its start cell)
+
   //cell_nr_x = ( ((pills[i].x - screen_offset_x) / factor) - (7 + MAZE_OFFSET_X) ) / (HORI_LINE_SIZE - 2);  
   //cell_nr_y = ( ((pills[i].y - screen_offset_y) / factor) - (4 + MAZE_OFFSET_Y) ) / (VERT_LINE_SIZE - 2);  
-  cell_nr_x = ( ((pills[i].x)) - (12 + MAZE_OFFSET_X) ) / (HORI_LINE_SIZE - 2);  
-  cell_nr_y = ( ((pills[i].y)) - ( 8 + MAZE_OFFSET_Y) ) / (VERT_LINE_SIZE - 2);    
+  cell_nr_x = ( ((game.pills[i].x)) - (12 + MAZE_OFFSET_X) ) / (HORI_LINE_SIZE - 2);  
+  cell_nr_y = ( ((game.pills[i].y)) - ( 8 + MAZE_OFFSET_Y) ) / (VERT_LINE_SIZE - 2);    
+  cell = cell_nr_y * NUM_HORI_CELLS + cell_nr_x;
+
+  // determine available directions
+  exits = maze_exits[game.maze_center_open - 1][cell];
+  if (exits & EXIT_LEFT)  left_open = 1;  else left_open = 0;
+  if (exits & EXIT_RIGHT) right_open = 1; else right_open = 0;
+  if (exits & EXIT_UP)    up_open = 1;    else up_open = 0;
+  if (exits & EXIT_DOWN)  down_open = 1;  else down_open = 0;
+
+  // do not choose center cell
+  if (cell_nr_y == 4 && cell_nr_x == 3)     right_open  = 0;
+  if (cell_nr_y == 4 && cell_nr_x == 5)     left_open  = 0;
+  if (cell_nr_y == 5 && cell_nr_x == 4)     up_open  = 0;
+  if (cell_nr_y == 3 && cell_nr_x == 4)     down_open  = 0;
+
+  // fleeing pills take the exit that leads away from the munchkin
+  // (same flow field as the chasing ghosts, so no extra search per pill)
+  found = 0;
+  if (game.pill_flee != 0 && rand()%10 < game.pill_flee) {
+     exits = 0;
+     if (left_open == 1)  exits |= EXIT_LEFT;
+     if (right_open == 1) exits |= EXIT_RIGHT;
+     if (up_open == 1)    exits |= EXIT_UP;
+     if (down_open == 1)  exits |= EXIT_DOWN;
+     found = flow_direction(cell, exits, game.pills[i].direction, TRUE);
+     if (found != 0) game.pills[i].direction = found;
+  }
 
-  //cell_x_pill = (MAZE_OFFSET_X  + 7 + cell_nr_x * 20) * factor + screen_offset_x;
-  //cell_y_pill = (MAZE_OFFSET_Y  + 4 + cell_nr_y * 14) * factor + screen_offset_y;
-  cell_x_pill = (MAZE_OFFSET_X  + 12 + cell_nr_x * 24);
-  cell_y_pill = (MAZE_OFFSET_Y  +  8 + cell_nr_y * 16);
+  if (found == 0) switch (game.pills[i].direction) {
+    case LEFT:  
+       // continue left (70% chance, else go up or down)
+       //    if not, go right back (return)
+       if (left_open == 1 && (up_open == 1 || down_open == 1) && ((rand()%10 >= 3) )) {
+          game.pills[i].direction = LEFT;
+       } else {
+                if (up_open == 1 || down_open == 1 ) {
+                   found = 0;
+                   while (found == 0) {  // go up or down, if possible
+                       if (rand()%2 == 0 && up_open == 1) {
+                           found = 1;
+                           game.pills[i].direction = UP;
+                       } else { 
+                                if (down_open == 1) {
+                                    found = 1;      
+                                    game.pills[i].direction = DOWN;
+                                }
+                       }
+                   }  // end while
+                 } else { 
+                         if (left_open == 1) {
+                             game.pills[i].direction = LEFT;
+                         } else {    
+                             game.pills[i].direction = RIGHT;
+                         } 
+                 }
+       }                 
+     break;
+   case RIGHT: 
+       // continue right (70% chance, else go up or down)
+       //    if not, go left back (return)
+       if (right_open == 1 && (up_open == 1 || down_open == 1) && ((rand()%10 >= 3) )) {
+          game.pills[i].direction = RIGHT;
+       } else {
+                if (up_open == 1 || down_open == 1 ) {
+                   found = 0;
+                   while (found == 0) {  // go up or down, if possible
+                       if (rand()%2 == 0 && up_open == 1) {
+                           found = 1;
+                           game.pills[i].direction = UP;
+                       } else { 
+                                if (down_open == 1) {
+                                    found = 1;      
+                                    game.pills[i].direction = DOWN;
+                                }
+                       }
+                   }  // end while
+                 } else { 
+                         if (right_open == 1) {
+                             game.pills[i].direction = RIGHT;
+                         } else {    
+                             game.pills[i].direction = LEFT;
+                         } 
+                 }
+       }                 
+     break;
+   case UP: 
+       // continue up (70% chance, else go left or right)
+       //    if not, go right down (return)
+       if (up_open == 1 && (left_open == 1 || right_open == 1) && ((rand()%10 >= 3) )) {
+          game.pills[i].direction = UP;
+       } else {
+                if (left_open == 1 || right_open == 1 ) {
+                   found = 0;
+                   while (found == 0) {  // go left or right, if possible
+                       if (rand()%2 == 0 && left_open == 1) {
+                           found = 1;
+                           game.pills[i].direction = LEFT;
+                       } else { 
+                                if (right_open == 1) {
+                                    found = 1;      
+                                    game.pills[i].direction = RIGHT;
+                                }
+                       }
+                   }  // end while
+                 } else { 
+                         if (up_open == 1) {
+                             game.pills[i].direction = UP;
+                         } else {    
+                             game.pills[i].direction = DOWN;
+                         } 
+                 }
+       }                 
+     break;
+   case DOWN: 
+       // continue down (70% chance, else go left or right)
+       //    if not, go right up (return)
+       if (down_open == 1 && (left_open == 1 || right_open == 1) && ((rand()%10 >= 3) )) {
+          game.pills[i].direction = DOWN;
+       } else {
+                if (left_open == 1 || right_open == 1 ) {
+                   found = 0;
+                   while (found == 0) {  // go left or right, if possible
+                       if (rand()%2 == 0 && left_open == 1) {
+                           found = 1;
+                           game.pills[i].direction = LEFT;
+                       } else { 
+                                if (right_open == 1) {
+                                    found = 1;      
+                                    game.pills[i].direction = RIGHT;
+                                }
+                       }
+                   }  // end while
+                 } else { 
+                         if (down_open == 1) {
+                             game.pills[i].direction = DOWN;
+                         } else {    
+                             game.pills[i].direction = UP;
+                         } 
+                 }
+       }                 
+     break;
+  }
 
- 
-  if (cell_x_pill == pills[i].x && cell_y_pill == pills[i].y) { // pill exactly in middle of cell
- 
-     // determine available directions
-     if (vertical_lines[cell_nr_y].line[cell_nr_x] == '|')       left_open  = 0; else left_open = 1;
-     if (vertical_lines[cell_nr_y].line[cell_nr_x + 1] == '|')   right_open = 0; else right_open = 1;
-     if (horizontal_lines[cell_nr_y].line[cell_nr_x] == 'x')     up_open = 0;    else up_open = 1;
-     if (horizontal_lines[cell_nr_y + 1].line[cell_nr_x] == 'x') down_open = 0;  else down_open = 1;
-
-     // do not choose center cell
-     if (cell_nr_y == 4 && cell_nr_x == 3)     right_open  = 0;
-     if (cell_nr_y == 4 && cell_nr_x == 5)     left_open  = 0;
-     if (cell_nr_y == 5 && cell_nr_x == 4)     up_open  = 0;
-     if (cell_nr_y == 3 && cell_nr_x == 4)     down_open  = 0;
-
-     switch (pills[i].direction) {
-       case LEFT:  
-          // continue left (70% chance, else go up or down)
-          //    if not, go right back (return)
-          if (left_open == 1 && (up_open == 1 || down_open == 1) && ((rand()%10 >= 3) )) {
-             pills[i].direction = LEFT;
-          } else {
-                   if (up_open == 1 || down_open == 1 ) {
-                      found = 0;
-                      while (found == 0) {  // go up or down, if possible
-                          if (rand()%2 == 0 && up_open == 1) {
-                              found = 1;
-                              pills[i].direction = UP;
-                          } else { 
-                                   if (down_open == 1) {
-                                       found = 1;      
-                                       pills[i].direction = DOWN;
-                                   }
-                          }
-                      }  // end while
-                    } else { 
-                            if (left_open == 1) {
-                                pills[i].direction = LEFT;
-                            } else {    
-                                pills[i].direction = RIGHT;
-                            } 
-                    }
-          }                 
-        break;
-      case RIGHT: 
-          // continue right (70% chance, else go up or down)
-          //    if not, go left back (return)
-          if (right_open == 1 && (up_open == 1 || down_open == 1) && ((rand()%10 >= 3) )) {
-             pills[i].direction = RIGHT;
-          } else {
-                   if (up_open == 1 || down_open == 1 ) {
-                      found = 0;
-                      while (found == 0) {  // go up or down, if possible
-                          if (rand()%2 == 0 && up_open == 1) {
-                              found = 1;
-                              pills[i].direction = UP;
-                          } else { 
-                                   if (down_open == 1) {
-                                       found = 1;      
-                                       pills[i].direction = DOWN;
-                                   }
-                          }
-                      }  // end while
-                    } else { 
-                            if (right_open == 1) {
-                                pills[i].direction = RIGHT;
-                            } else {    
-                                pills[i].direction = LEFT;
-                            } 
-                    }
-          }                 
-        break;
-      case UP: 
-          // continue up (70% chance, else go left or right)
-          //    if not, go right down (return)
-          if (up_open == 1 && (left_open == 1 || right_open == 1) && ((rand()%10 >= 3) )) {
-             pills[i].direction = UP;
-          } else {
-                   if (left_open == 1 || right_open == 1 ) {
-                      found = 0;
-                      while (found == 0) {  // go left or right, if possible
-                          if (rand()%2 == 0 && left_open == 1) {
-                              found = 1;
-                              pills[i].direction = LEFT;
-                          } else { 
-                                   if (right_open == 1) {
-                                       found = 1;      
-                                       pills[i].direction = RIGHT;
-                                   }
-                          }
-                      }  // end while
-                    } else { 
-                            if (up_open == 1) {
-                                pills[i].direction = UP;
-                            } else {    
-                                pills[i].direction = DOWN;
-                            } 
-                    }
-          }                 
-        break;
-      case DOWN: 
-          // continue down (70% chance, else go left or right)
-          //    if not, go right up (return)
-          if (down_open == 1 && (left_open == 1 || right_open == 1) && ((rand()%10 >= 3) )) {
-             pills[i].direction = DOWN;
-          } else {
-                   if (left_open == 1 || right_open == 1 ) {
-                      found = 0;
-                      while (found == 0) {  // go left or right, if possible
-                          if (rand()%2 == 0 && left_open == 1) {
-                              found = 1;
-                              pills[i].direction = LEFT;
-                          } else { 
-                                   if (right_open == 1) {
-                                       found = 1;      
-                                       pills[i].direction = RIGHT;
-                                   }
-                          }
-                      }  // end while
-                    } else { 
-                            if (down_open == 1) {
-                                pills[i].direction = DOWN;
-                            } else {    
-                                pills[i].direction = UP;
-                            } 
-                    }
-          }                 
-        break;
-     }
-  }  // if middle of cell
+  game.pills[i].countdown = edge_length(cell, game.pills[i].direction);
 }
 
 
 void rotate_maze_center(void)
 {
    /* set next rotate action (clockwise) */
-   if (maze_center_open == DOWN) maze_center_open = LEFT;
-   else if (maze_center_open == LEFT) maze_center_open = UP;
-     else if (maze_center_open == UP) maze_center_open = RIGHT;
-        else if (maze_center_open == RIGHT) maze_center_open = DOWN;
+   if (game.maze_center_open == DOWN) game.maze_center_open = LEFT;
+   else if (game.maze_center_open == LEFT) game.maze_center_open = UP;
+     else if (game.maze_center_open == UP) game.maze_center_open = RIGHT;
+        else if (game.maze_center_open == RIGHT) game.maze_center_open = DOWN;
    
-   /* change maze structure */
-   switch (maze_center_open) {
-   case LEFT:    
-     horizontal_lines[4].line[4] = 'x';
-     vertical_lines[4].line[4] = '-'; vertical_lines[4].line[5] = '|';
-     horizontal_lines[5].line[4] = 'x';
-     break;
-   case RIGHT:    
-     horizontal_lines[4].line[4] = 'x';
-     vertical_lines[4].line[4] = '|'; vertical_lines[4].line[5] = '-';
-     horizontal_lines[5].line[4] = 'x';
-     break;
-   case UP:    
-     horizontal_lines[4].line[4] = '-';
-     vertical_lines[4].line[4] = '|'; vertical_lines[4].line[5] = '|';
-     horizontal_lines[5].line[4] = 'x';
-     break;
-   case DOWN:    
-     horizontal_lines[4].line[4] = 'x';
-     vertical_lines[4].line[4] = '|'; vertical_lines[4].line[5] = '|';
-     horizontal_lines[5].line[4] = '-';
-     break;
-   }
+   /* change maze structure (the junction graph already has all four rotations) */
+   set_maze_center_walls(game.maze_center_open);
+   flow_target = FLOW_UNSET;     // paths through the center changed, rebuild flow field
 
      /* Change maze display (close previous, open new
         Using global variables ! UDG's set in setup()*/
-     switch (maze_center_open) {
+     switch (game.maze_center_open) {
       case RIGHT:    
        // close top
-       if (maze_selected == 1) sp1_TileEntry('#', udg_top_left); 
+       if (game.maze_selected == 1) sp1_TileEntry('#', udg_top_left); 
          else sp1_TileEntry('#', udg_top_left_maze2); 
        //sp1_TileEntry('@', udg_line_hori);  // already defnied
 
@@ -1984,9 +3136,9 @@ void rotate_maze_center(void)
        sp1_PrintAtInv(12, 16, BRIGHT | INK_MAGENTA | PAPER_BLACK, '@');
 
        // open right
-       if (maze_selected == 1) sp1_TileEntry('(', udg_line_hori_left); 
+       if (game.maze_selected == 1) sp1_TileEntry('(', udg_line_hori_left); 
          else sp1_TileEntry('(', udg_bottom_right); 
-       if (maze_selected == 1) sp1_TileEntry('{', udg_line_hori_left);   
+       if (game.maze_selected == 1) sp1_TileEntry('{', udg_line_hori_left);   
          else sp1_TileEntry('{',  udg_line_hori); 
 
        sp1_PrintAtInv(12, 17, BRIGHT | INK_MAGENTA | PAPER_BLACK, '(');
@@ -1995,17 +3147,17 @@ void rotate_maze_center(void)
        break;
      case LEFT:    
        sp1_TileEntry('@', udg_line_hori);
-       if (maze_selected == 1)  sp1_TileEntry(']', udg_line_hori_right);
+       if (game.maze_selected == 1)  sp1_TileEntry(']', udg_line_hori_right);
          else sp1_TileEntry(']', udg_line_hori_left_maze2);
-       if (maze_selected == 1) sp1_TileEntry('[', udg_bottom_right); 
+       if (game.maze_selected == 1) sp1_TileEntry('[', udg_bottom_right); 
           else  sp1_TileEntry('[', udg_line_hori_left_maze2);
-       if (maze_selected == 1) sp1_TileEntry(']', udg_line_hori_right);
+       if (game.maze_selected == 1) sp1_TileEntry(']', udg_line_hori_right);
           else sp1_TileEntry('*', udg_top_left);
 
        // open left
        sp1_PrintAtInv(12, 14, BRIGHT | INK_MAGENTA | PAPER_BLACK, ']');
        sp1_PrintAtInv(13, 14, BRIGHT | INK_MAGENTA | PAPER_BLACK, ' ');
-       if (maze_selected == 1) sp1_PrintAtInv(14, 14, BRIGHT | INK_MAGENTA | PAPER_BLACK, ']');
+       if (game.maze_selected == 1) sp1_PrintAtInv(14, 14, BRIGHT | INK_MAGENTA | PAPER_BLACK, ']');
           else sp1_PrintAtInv(14, 14, BRIGHT | INK_MAGENTA | PAPER_BLACK, '*');
        
        // close bottom
@@ -2015,17 +3167,17 @@ void rotate_maze_center(void)
        break;
      case UP:    
        // close left
-       if (maze_selected == 1)  sp1_TileEntry('%', udg_line_vert_top); 
+       if (game.maze_selected == 1)  sp1_TileEntry('%', udg_line_vert_top); 
           else sp1_TileEntry('%', udg_line_vert_top_maze2); 
        sp1_TileEntry('^', udg_line_vert); 
-       if (maze_selected == 1) sp1_TileEntry('&', udg_bottom_left); 
+       if (game.maze_selected == 1) sp1_TileEntry('&', udg_bottom_left); 
           else sp1_TileEntry('&', udg_bottom_left_maze2); 
        sp1_PrintAtInv(12, 14, BRIGHT | INK_MAGENTA | PAPER_BLACK, '%');
        sp1_PrintAtInv(13, 14, BRIGHT | INK_MAGENTA | PAPER_BLACK, '^');
        sp1_PrintAtInv(14, 14, BRIGHT | INK_MAGENTA | PAPER_BLACK, '&');
        
        // open top
-       if (maze_selected == 1) sp1_TileEntry(')', udg_line_vert_top);
+       if (game.maze_selected == 1) sp1_TileEntry(')', udg_line_vert_top);
           else sp1_TileEntry(')', udg_line_vert); 
 
        sp1_PrintAtInv(12, 15, BRIGHT | INK_MAGENTA | PAPER_BLACK, ' ');
@@ -2034,12 +3186,12 @@ void rotate_maze_center(void)
        break;
      case DOWN:    
        // close right
-       if (maze_selected == 1) sp1_TileEntry('+', udg_top_right); 
+       if (game.maze_selected == 1) sp1_TileEntry('+', udg_top_right); 
          else sp1_TileEntry('+',  udg_line_vert_top_maze2); 
        //sp1_TileEntry('^', udg_line_vert);   // already defined
-       if (maze_selected == 1) sp1_TileEntry('?', udg_line_vert_bottom); 
+       if (game.maze_selected == 1) sp1_TileEntry('?', udg_line_vert_bottom); 
          else sp1_TileEntry('?', udg_bottom_left); 
-       if (maze_selected == 1) sp1_TileEntry(';', udg_line_vert_bottom); 
+       if (game.maze_selected == 1) sp1_TileEntry(';', udg_line_vert_bottom); 
          else sp1_TileEntry(';', udg_line_vert);   
 
        sp1_PrintAtInv(12, 17, BRIGHT | INK_MAGENTA | PAPER_BLACK, '+');
@@ -2053,18 +3205,256 @@ void rotate_maze_center(void)
        sp1_PrintAtInv(14, 15, BRIGHT | INK_MAGENTA | PAPER_BLACK, ' ');
        sp1_PrintAtInv(14, 16, BRIGHT | INK_MAGENTA | PAPER_BLACK, ' ');
        break;
-     }     
+     }
+     // with FRAME_PACING or BEAM_RACING update_screen() at the end of the step shows it,
+     // a wait() here would take the frame of the paced loop and hide a late step
+#if !defined(FRAME_PACING) && !defined(BEAM_RACING)
      wait();
      sp1_UpdateNow();
+#endif
 
 }
 
 
-unsigned char block_of_ram[5000];   // ??
+void set_maze_center_walls(unsigned char center_open)
+{
+   switch (center_open) {
+   case LEFT:    
+     game.horizontal_lines[4].line[4] = 'x';
+     game.vertical_lines[4].line[4] = '-'; game.vertical_lines[4].line[5] = '|';
+     game.horizontal_lines[5].line[4] = 'x';
+     break;
+   case RIGHT:    
+     game.horizontal_lines[4].line[4] = 'x';
+     game.vertical_lines[4].line[4] = '|'; game.vertical_lines[4].line[5] = '-';
+     game.horizontal_lines[5].line[4] = 'x';
+     break;
+   case UP:    
+     game.horizontal_lines[4].line[4] = '-';
+     game.vertical_lines[4].line[4] = '|'; game.vertical_lines[4].line[5] = '|';
+     game.horizontal_lines[5].line[4] = 'x';
+     break;
+   case DOWN:    
+     game.horizontal_lines[4].line[4] = 'x';
+     game.vertical_lines[4].line[4] = '|'; game.vertical_lines[4].line[5] = '|';
+     game.horizontal_lines[5].line[4] = '-';
+     break;
+   }
+}
+
+
+void build_maze_graph(void)
+{
+  // Ghosts and pills only make a decision at a node. Between two nodes they
+  // follow a corridor and just count down the pixels in maze_run[][].
+  // Cells whose exits change with the center rotation are always nodes, so
+  // the corridor lengths are the same for all four rotations.
+  unsigned char rotation, cell, cell_x, cell_y, direction, steps, length, exits;
+
+  // open exits of every cell, for each center rotation
+  for (rotation = 0; rotation < 4; rotation++) {
+     set_maze_center_walls(rotation + 1);
+     cell = 0;
+     for (cell_y = 0; cell_y < NUM_VERT_CELLS; cell_y++) {
+        for (cell_x = 0; cell_x < NUM_HORI_CELLS; cell_x++, cell++) {
+           exits = 0;
+           if (game.vertical_lines[cell_y].line[cell_x] != '|')       exits |= EXIT_LEFT;
+           if (game.vertical_lines[cell_y].line[cell_x + 1] != '|')   exits |= EXIT_RIGHT;
+           if (game.horizontal_lines[cell_y].line[cell_x] != 'x')     exits |= EXIT_UP;
+           if (game.horizontal_lines[cell_y + 1].line[cell_x] != 'x') exits |= EXIT_DOWN;
+           maze_exits[rotation][cell] = exits;
+        }
+     }
+  }
+  set_maze_center_walls(game.maze_center_open);
+
+  // mark the nodes: everything except straight corridors that never change
+  for (cell = 0; cell < NUM_CELLS; cell++) {
+     exits = maze_exits[0][cell];
+     if ((exits != (EXIT_LEFT | EXIT_RIGHT) && exits != (EXIT_UP | EXIT_DOWN)) ||
+         exits != maze_exits[1][cell] || exits != maze_exits[2][cell] || exits != maze_exits[3][cell]) {
+        for (rotation = 0; rotation < 4; rotation++) maze_exits[rotation][cell] |= CELL_NODE;
+     }
+  }
+
+  // edges: pixels from every cell to the next node in each direction
+  for (cell = 0; cell < NUM_CELLS; cell++) {
+     for (direction = LEFT; direction <= DOWN; direction++) {
+        cell_x = cell % NUM_HORI_CELLS;
+        cell_y = cell / NUM_HORI_CELLS;
+        length = 0;
+
+        // at most one row, also stops a corridor that wraps onto itself
+        for (steps = 0; steps < NUM_HORI_CELLS; steps++) {
+           switch (direction) {
+           case LEFT:
+              if (cell_x == 0) { cell_x = NUM_HORI_CELLS - 1; length += TUNNEL_LENGTH; }
+                 else { cell_x--; length += HORI_LINE_SIZE - 2; }
+              break;
+           case RIGHT:
+              if (cell_x == NUM_HORI_CELLS - 1) { cell_x = 0; length += TUNNEL_LENGTH; }
+                 else { cell_x++; length += HORI_LINE_SIZE - 2; }
+              break;
+           case UP:
+              if (cell_y == 0) steps = NUM_HORI_CELLS;        // outer wall, never open
+                 else { cell_y--; length += VERT_LINE_SIZE - 2; }
+              break;
+           case DOWN:
+              if (cell_y == NUM_VERT_CELLS - 1) steps = NUM_HORI_CELLS;
+                 else { cell_y++; length += VERT_LINE_SIZE - 2; }
+              break;
+           }
+           if (maze_exits[0][cell_y * NUM_HORI_CELLS + cell_x] & CELL_NODE) break;
+        }
+        maze_run[cell][direction - 1] = length;
+     }
+  }
+}
+
+
+unsigned char edge_length(unsigned char cell, unsigned char direction)
+{
+  // pixels to travel before the next decision
+  if (direction == 0) return 0;     // standing still (recharging ghost)
+
+  if (maze_exits[game.maze_center_open - 1][cell] & exit_bit[direction])
+     return maze_run[cell][direction - 1];
+
+  // walking into a wall: re-decide after one cell, like before
+  if (direction == LEFT || direction == RIGHT) return HORI_LINE_SIZE - 2;
+  return VERT_LINE_SIZE - 2;
+}
+
+
+unsigned char neighbour_cell(unsigned char cell, unsigned char direction)
+{
+  // cell reached through an open exit (left and right wrap through the tunnel)
+  switch (direction) {
+  case LEFT:
+     if (cell % NUM_HORI_CELLS == 0) return cell + NUM_HORI_CELLS - 1;
+     return cell - 1;
+  case RIGHT:
+     if (cell % NUM_HORI_CELLS == NUM_HORI_CELLS - 1) return cell - (NUM_HORI_CELLS - 1);
+     return cell + 1;
+  case UP:
+     return cell - NUM_HORI_CELLS;
+  }
+  return cell + NUM_HORI_CELLS;   // DOWN
+}
+
+
+void update_flow_field(void)
+{
+  int cell_x, cell_y;             // integer, because cell_x == -1 when left of port
+  unsigned char cell, next, exits, direction, count;
+
+  cell_x = ( (game.munchkin_x_factor1) - (12 + MAZE_OFFSET_X) ) / (HORI_LINE_SIZE - 2);
+  cell_y = ( (game.munchkin_y_factor1) - ( 8 + MAZE_OFFSET_Y) ) / (VERT_LINE_SIZE - 2);
+  if (cell_x < 0) cell_x = NUM_HORI_CELLS - 1;                 // in the tunnel
+  if (cell_x >= NUM_HORI_CELLS) cell_x = 0;
+  if (cell_y >= NUM_VERT_CELLS) cell_y = NUM_VERT_CELLS - 1;
+  cell = cell_y * NUM_HORI_CELLS + cell_x;
+
+  // munchkin moved to another cell: start a new search from there
+  if (cell != flow_target) {
+     memset(flow_dist, FLOW_UNSET, NUM_CELLS);
+     flow_target = cell;
+     flow_dist[cell] = 0;
+     flow_queue[0] = cell;
+     flow_head = 0;
+     flow_tail = 1;
+  }
+
+  // expand a few cells per frame
+  for (count = 0; count < FLOW_CELLS_PER_FRAME && flow_head != flow_tail; count++) {
+     cell = flow_queue[flow_head++];
+     exits = maze_exits[game.maze_center_open - 1][cell];
+     for (direction = LEFT; direction <= DOWN; direction++) {
+        if (exits & exit_bit[direction]) {
+           next = neighbour_cell(cell, direction);
+           if (flow_dist[next] == FLOW_UNSET) {
+              flow_dist[next] = flow_dist[cell] + 1;
+              flow_queue[flow_tail++] = next;
+           }
+        }
+     }
+  }
+}
+
+
+unsigned char flow_direction(unsigned char cell, unsigned char exits, unsigned char direction, unsigned char flee)
+{
+  // exit with the shortest (flee: longest) way to the munchkin, never back
+  // unless it is a dead end (flee: or the only way that gets further away)
+  // returns 0 when the flow field has not reached the exits of this cell yet
+  unsigned char d, best, best_dist, dist, others, back;
+
+  best = 0;
+  if (flee == TRUE) best_dist = 0; else best_dist = FLOW_UNSET;
+  others = 0;
+
+  for (d = LEFT; d <= DOWN; d++) {
+     if ((exits & exit_bit[d]) && d != reverse_direction[direction]) {
+        others++;
+        dist = flow_dist[neighbour_cell(cell, d)];
+        if (dist == FLOW_UNSET) continue;
+        if ((flee == FALSE && dist < best_dist) || (flee == TRUE && dist >= best_dist)) {
+           best_dist = dist;
+           best = d;
+        }
+     }
+  }
+
+  back = reverse_direction[direction];
+  if ((exits & exit_bit[back]) == 0) return best;
+
+  if (others == 0) return back;
+
+  // fleeing towards the munchkin: turn around if that is the only way away from it
+  if (flee == TRUE && flow_dist[cell] != FLOW_UNSET && (best == 0 || best_dist <= flow_dist[cell])) {
+     dist = flow_dist[neighbour_cell(cell, back)];
+     if (dist != FLOW_UNSET && dist > flow_dist[cell]) best = back;
+  }
+  return best;
+}
+
+
+unsigned char block_of_ram[(SP1_BLOCKS - SP1_BLOCKS_HIGH) * 25];   // rest of the sp1 blocks
+
+
+#ifdef MEMORY_STATS
+
+void paint_stack(void)
+{
+   unsigned char *p;
+
+   // everything below this function's frame is unused (interrupts are still off)
+   for (p = (unsigned char *)STACK_BOTTOM; p < (unsigned char *)&p - 16; ++p) *p = STACK_PAINT;
+}
+
+
+void update_memory_stats(void)
+{
+   unsigned char *p;
+
+   for (p = (unsigned char *)STACK_BOTTOM; p < (unsigned char *)STACK_TOP && *p == STACK_PAINT; ++p) ;
+
+   memory_stats.magic[0] = 'M';
+   memory_stats.magic[1] = 'S';
+   memory_stats.stack_peak = STACK_TOP - (unsigned int)p;
+   memory_stats.blocks_peak = blocks_peak;
+   memory_stats.blocks_low = SP1_BLOCKS - blocks_peak;
+}
+
+#endif
 
 
 void setup(void)
 {
+#ifdef MEMORY_STATS
+   paint_stack();
+#endif
+
    // the crt has disabled interrupts before main is called
    zx_border(INK_BLACK);
 
@@ -2072,76 +3462,161 @@ void setup(void)
    // max size requested by sp1 will be 24 bytes or block size of 25 (+1 for overhead)
    balloc_reset(0);                                              // make queue 0 empty
    balloc_addmem(0, sizeof(block_of_ram)/25, 24, block_of_ram);  // add free memory from bss section
-   balloc_addmem(0, 8, 24, (void *)0xd101);                      // another eight from an unused area
+   balloc_addmem(0, SP1_BLOCKS_HIGH, 24, (void *)0xd101);        // another eight from an unused area
 
    // interrupt mode 2
+   // (enabled straight away so tick also counts the rest of the startup)
    setup_int();
+   intrinsic_ei();
 
+#ifdef PREBUILT_ROTTBL
+   // rotation tables already loaded from tape at 0xf200 (tools/mkrottbl.py, see build.sh)
+   sp1_Initialize(SP1_IFLAG_OVERWRITE_TILES | SP1_IFLAG_OVERWRITE_DFILE, INK_BLACK | PAPER_BLACK, ' ');
+#else
    sp1_Initialize(SP1_IFLAG_MAKE_ROTTBL | SP1_IFLAG_OVERWRITE_TILES | SP1_IFLAG_OVERWRITE_DFILE, INK_BLACK | PAPER_BLACK, ' ');
+#endif
    
    ps0.bounds = &cr;
    ps0.flags = SP1_PSSFLAG_INVALIDATE;
    ps0.visit = 0;
 
-   intrinsic_ei();
-
    // setup the backgroundd tiles
+   // (after sp1_Initialize, which sets up the tile array with SP1_IFLAG_OVERWRITE_TILES)
+#ifdef ZX128
+   load_maze_pack(1);
+   pt = maze_tiles;
+#else
    pt = tiles;
+#endif
    for (i = 0; i < TILES_LEN; ++i, pt += 8)
       sp1_TileEntry(TILES_BASE + i, pt);
 
+#ifdef PILL_LAYER
+   setup_pill_layer();
+#endif
+
    // initialize pills.status (needed for cleaning of sprites later)
-   for (i = 0; i < NUM_PILLS; i++) (pills[i].status = 0);
+   for (i = 0; i < NUM_PILLS; i++) (game.pills[i].status = 0);
+   game.frame = 1;
 }
 
 
 void start_new_game(void) 
 {
-  munchkin_dying = FALSE;
-  score = 0;
+  game.munchkin_dying = FALSE;
+  game.score = 0;
   
-  speed = 2;             // values 1 or 2 
-  maze_selected = 1;
+  game.speed = 2;             // values 1 or 2 
+  game.maze_selected = 1;
+  game.num_chasers = GHOST_CHASERS;
+  game.mazes_completed = 0;
   start_new_maze();
 }
 
 
-void start_new_maze(void) 
+void *arena_alloc(unsigned int size)
 {
-  munchkin_x_factor1 = (MAZE_OFFSET_X + 4 * (HORI_LINE_SIZE -2)) + 12;  // 112 + 12
-  munchkin_y_factor1 = (MAZE_OFFSET_Y + 3 * (VERT_LINE_SIZE -2)) + 8;  // 80  +  8
-
+  unsigned char *p;
+
+  // bump allocation, no free: everything goes at once when start_new_maze() resets arena_top
+#ifdef MEMORY_STATS
+  if (arena_top + size > ARENA_SIZE) {   // debug build: stop with a red border
+     zx_border(INK_RED);
+     intrinsic_di();
+     while (1) intrinsic_halt();
+  }
+#endif
+  p = TEMPMEM + arena_top;
+  arena_top += size;
+  return p;
+}
 
-  munchkin_auto_direction  = 0;    // stationary 
-  munchkin_last_direction  = 0;    // stationary 
-  munchkin_animation_frame = 0;
-  munchkin_dying_animation = 0;
-  maze_center_open = DOWN;         // 4=down open at startup
-  maze_completed = FALSE;             
-  maze_color = 3;
-  last_pill_speed_increased = FALSE;
-  powerpill_active_timer = 0;
-
-  setup_maze();
 
+void setup_maze_tiles(void)
+{
   // setup the background tiles (16 UDG's)
-  if (maze_selected == 1)  pt = tiles;
+#ifdef ZX128
+  load_maze_pack(game.maze_selected);
+  pt = maze_tiles;
+#else
+  if (game.maze_selected == 1)  pt = tiles;
       else pt = tiles_maze2;
+#endif
 
   // set up tiles (UDG's) for the maze
   for (i = 0; i < TILES_LEN; ++i, pt += 8)
       sp1_TileEntry(TILES_BASE + i, pt);
+}
+
+
+#ifdef ZX128
+void load_maze_pack(unsigned char maze)
+{
+  // directory entry of the maze first, then its screen and tiles
+  bank_copy_args.bank = MAZE_BANK;
+  bank_copy_args.src  = &MAZE_PACKS[maze - 1];
+  bank_copy_args.dst  = &maze_pack;
+  bank_copy_args.len  = sizeof(maze_pack_type);
+  bank_copy(&bank_copy_args);
+
+  bank_copy_args.src  = maze_pack.ptiles;
+  bank_copy_args.dst  = maze_ptiles;
+  bank_copy_args.len  = maze_pack.ptiles_len;
+  bank_copy(&bank_copy_args);
+
+  bank_copy_args.src  = maze_pack.tiles;
+  bank_copy_args.dst  = maze_tiles;
+  bank_copy_args.len  = TILES_LEN * 8;
+  bank_copy(&bank_copy_args);
+}
+#endif
+
+
+void start_new_maze(void) 
+{
+  game.munchkin_x_factor1 = (MAZE_OFFSET_X + 4 * (HORI_LINE_SIZE -2)) + 12;  // 112 + 12
+  game.munchkin_y_factor1 = (MAZE_OFFSET_Y + 3 * (VERT_LINE_SIZE -2)) + 8;  // 80  +  8
+
+
+  game.munchkin_auto_direction  = 0;    // stationary 
+  game.munchkin_last_direction  = 0;    // stationary 
+  anim_start(&game.munchkin_anim, munchkin_alive_anim);
+  anim_start(&game.munchkin_walk, munchkin_walk_anim);
+  anim_start(&ghost_anims[FRAMES_NORMAL], ghost_steady_anim);
+  anim_start(&ghost_anims[FRAMES_POWERPILL], ghost_steady_anim);
+  anim_start(&ghost_anims[FRAMES_DEAD], ghost_dead_anim);
+  game.maze_center_open = DOWN;         // 4=down open at startup
+  game.maze_completed = FALSE;             
+  game.maze_color = 3;
+  game.last_pill_speed_increased = FALSE;
+  game.powerpill_active_timer = 0;
+  flow_target = FLOW_UNSET;        // no flow field yet
+  game.ghosts_chasing = TRUE;
+  game.ghost_mode_timer = CHASE_FRAMES;
+
+  game.pill_flee = 0;
+  if (PILL_FLEE != 0) {
+     if (game.mazes_completed < sizeof(pill_flee_levels)) game.pill_flee = pill_flee_levels[game.mazes_completed];
+        else game.pill_flee = pill_flee_levels[sizeof(pill_flee_levels) - 1];
+  }
+
+  setup_maze();
+
+  // tables of this maze (ARENA_SIZE bytes: 1024, 768 in the 128K build; ARENA_USED = 630 taken)
+  arena_top = 0;
+  maze_exits = arena_alloc(4 * NUM_CELLS);
+  maze_run   = arena_alloc(NUM_CELLS * 4);
+  flow_dist  = arena_alloc(NUM_CELLS);
+  flow_queue = arena_alloc(NUM_CELLS);
+
+  build_maze_graph();
+  setup_maze_tiles();
 
   setup_ghosts();
   setup_pills();
 
   // display maze color: magenta
-  ptiles[1] = 0x43;
-  ptiles_maze2[1] = 0x43;
-  sp1_SetPrintPos(&ps0, 0, 0);
-
-  if (maze_selected == 1) sp1_PrintString(&ps0, ptiles);
-     else  sp1_PrintString(&ps0, ptiles_maze2);
+  print_maze(BRIGHT | INK_MAGENTA | PAPER_BLACK);
 
   display_score();
 }
@@ -2152,55 +3627,91 @@ void hide_sprites(void)
   // delete any inactive pill-sprites (e.g. when level not completed)
   // (pill status initialized in setup()
   for (i = 0; i < NUM_PILLS; i++) {
-    if (pills[i].status != 0) {
-          sp1_MoveSprAbs(pills[i].sprite, &cr, NULL, 0, 34, 0, 0);  // remove from screen
-                                                                    // print at column 34
-          sp1_DeleteSpr(pills[i].sprite);
-          pills[i].status = 0;   
+    if (game.pills[i].status != 0) {
+          delete_pill_sprite(i);
+          game.pills[i].status = 0;   
      }      
   }
 
   for (i = 0; i < NUM_GHOSTS; i++)  {
-    sp1_MoveSprAbs(ghosts[i].sprite, &cr, NULL, 0, 34, 0, 0);  // remove from screen
+    sp1_MoveSprAbs(game.ghosts[i].sprite, &cr, NULL, 0, 34, 0, 0);  // remove from screen
                                                                // print at column 34
-    get_ink_colour(ghosts[i].colour);  // set to original colour
-    sp1_IterateSprChar(ghosts[i].sprite, add_colour_to_sprite);
+    get_ink_colour(game.ghosts[i].colour);  // set to original colour
+    sp1_IterateSprChar(game.ghosts[i].sprite, add_colour_to_sprite);
   }  
 
   sp1_MoveSprAbs(munchkin_sprite, &cr, NULL, 0, 34, 0, 0);  // remove from screen
 }
 
 
-int main(void)
+void save_game(game_state_type *s)
 {
-   unsigned char idle = 0;
+  memcpy(s, &game, sizeof(game_state_type));
+}
 
-   setup();
 
-   zx_border(INK_BLACK);
+unsigned char restore_game(game_state_type *s)
+{
+  unsigned char maze, center, target, rotations;
 
-   // set up the block memory allocator with one queue
-   // max size requested by sp1 will be 24 bytes or block size of 25 (+1 for overhead)
-   balloc_reset(0);                                              // make queue 0 empty
-   balloc_addmem(0, sizeof(block_of_ram)/25, 24, block_of_ram);  // add free memory from bss section
-   balloc_addmem(0, 8, 24, (void *)0xd101);                      // another eight from an unused area
+  if (s->version != GAME_STATE_VERSION) return FALSE;
 
-   // interrupt mode 2
-   setup_int();
+  // the sprites belong to the running game: ghosts keep theirs,
+  // pills get a new one if not eaten in the saved game
+  for (i = 0; i < NUM_PILLS; i++) {
+    if (game.pills[i].status != 0) delete_pill_sprite(i);
+  }
+  for (i = 0; i < NUM_GHOSTS; i++) s->ghosts[i].sprite = game.ghosts[i].sprite;
 
-   sp1_Initialize(SP1_IFLAG_MAKE_ROTTBL | SP1_IFLAG_OVERWRITE_TILES | SP1_IFLAG_OVERWRITE_DFILE, INK_BLACK | PAPER_BLACK, ' ');
-   
-   ps0.bounds = &cr;
-   ps0.flags = SP1_PSSFLAG_INVALIDATE;
-   ps0.visit = 0;
+  maze = game.maze_selected;         // as on the screen now
+  center = game.maze_center_open;
+  memcpy(&game, s, sizeof(game_state_type));
 
-   intrinsic_ei();
+  for (i = 0; i < NUM_PILLS; i++) {
+    if (game.pills[i].status != 0) create_pill_sprite(i);
+  }
+  for (i = 0; i < NUM_GHOSTS; i++) {
+    get_ghost_ink(i);
+    sp1_IterateSprChar(game.ghosts[i].sprite, add_colour_to_sprite);
+  }
+
+  // turn the center on the screen to the saved one (this also sets the walls)
+  // a maze from the other game is printed first, with the center open at the
+  // bottom, and turned round once to set all center tiles for that maze
+  rotations = 0;
+  if (game.maze_selected != maze) {
+     build_maze_graph();
+     setup_maze_tiles();
+     if (game.maze_color == '6') print_maze(BRIGHT | INK_YELLOW | PAPER_BLACK);
+        else print_maze(BRIGHT | INK_MAGENTA | PAPER_BLACK);
+     rotations = 4;
+     center = DOWN;
+  }
+  target = game.maze_center_open;
+  game.maze_center_open = center;
+  while (rotations != 0 || game.maze_center_open != target) {
+     rotate_maze_center();
+     if (rotations != 0) rotations--;
+  }
+
+  flow_target = FLOW_UNSET;          // rebuilt from the restored maze
+  display_score();
+  return TRUE;
+}
+
+
+int main(void)
+{
+   unsigned char idle = 0;
+
+   setup();     // everything that is done only once
+   startup_frames = tick;
 
    draw_menu();
 
    srand(tick);  // 256 different games are possible
    high_score = 0,
-   active_pills = NUM_PILLS;
+   game.active_pills = NUM_PILLS;
 
    while(1)
    {
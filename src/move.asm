@@ -0,0 +1,541 @@
+
+; Movement kernels in assembly, used instead of the C versions in main.c
+; when built with -DASM_MOVEMENT (see build.sh).
+;
+; They must behave exactly like move_munchkin() and move_actor() in main.c.
+
+IFDEF ASM_MOVEMENT
+
+SECTION code_user
+
+PUBLIC _move_munchkin
+PUBLIC _move_actor
+
+EXTERN _game
+
+defc LEFT  = 1
+defc RIGHT = 2
+defc UP    = 3
+defc DOWN  = 4
+
+; offsets in game_state_type (game in main.c), checked by the move_asm_* COMPILE_CHECKs there
+
+defc GAME_MUNCHKIN_X         = 1
+defc GAME_MUNCHKIN_Y         = 2
+defc GAME_AUTO_DIRECTION     = 3
+defc GAME_LAST_DIRECTION     = 4
+defc GAME_SPEED              = 5
+defc GAME_HORIZONTAL_LINES   = 6
+defc GAME_VERTICAL_LINES     = 86
+
+; offsets in actor_type (ghost_sprite and pill_sprite), also checked in main.c
+
+defc ACTOR_X         = 2
+defc ACTOR_DIRECTION = 6
+
+
+_move_actor:
+
+; void move_actor(actor_type *actor)
+; fastcall linkage: hl = actor
+
+   inc hl
+   inc hl                      ; hl = &actor->x
+   ld e,l
+   ld d,h
+   ld bc,ACTOR_DIRECTION - ACTOR_X
+   add hl,bc
+   ld a,(hl)                   ; a = direction
+   inc hl
+   ld c,(hl)                   ; c = speed
+   inc hl
+   ex de,hl                    ; hl = &actor->x, de = &actor->countdown
+
+   dec a
+   jr z, actor_left
+   dec a
+   jr z, actor_right
+   inc hl                      ; hl = &actor->y
+   dec a
+   jr z, actor_up
+   dec a
+   jr nz, actor_countdown
+
+   ; down
+
+   ld a,(hl)
+   add a,c
+   jr actor_store
+
+actor_up:
+
+   ld a,(hl)
+   sub c
+   jr actor_store
+
+actor_left:
+
+   ld a,(hl)
+   sub c
+   cp 8
+   jr nc, actor_store
+   add a,236                   ; wrap screen left (WRAP_WIDTH)
+   jr actor_store
+
+actor_right:
+
+   ld a,(hl)
+   add a,c
+   cp 243
+   jr c, actor_store
+   sub 236                     ; wrap screen right (WRAP_WIDTH)
+
+actor_store:
+
+   ld (hl),a
+
+actor_countdown:
+
+   ld a,(de)
+   or a
+   ret z
+   sub c
+   ld (de),a
+   ret
+
+
+_move_munchkin:
+
+; void move_munchkin(unsigned char munchkin_direction)
+; fastcall linkage: l = munchkin_direction (0 = no key pressed, auto move)
+
+   ld a,l
+   or a
+   jp z, auto_move
+
+   ; cell of the munchkin: c = cell_x (-1 .. 9), b = cell_y (0 .. 6)
+   ; the C version divides signed, so x <= 4 gives cell_x = -1
+
+   ld a,(_game + GAME_MUNCHKIN_X)
+   ld c,$ff
+   cp 5
+   jr c, cell_x_done
+   inc c
+   sub 28
+   jr c, cell_x_done
+
+cell_x_loop:
+
+   sub 24
+   jr c, cell_x_done
+   inc c
+   jr cell_x_loop
+
+cell_x_done:
+
+   ld a,(_game + GAME_MUNCHKIN_Y)
+   sub 40                      ; the munchkin never leaves the maze rows
+   rrca
+   rrca
+   rrca
+   rrca
+   and $0f
+   ld b,a
+
+   ld a,l
+   cp LEFT
+   jr z, manual_left
+   cp RIGHT
+   jp z, manual_right
+   cp UP
+   jp z, manual_up
+   cp DOWN
+   ret nz
+
+manual_down:
+
+   ; blocked if wall below and past the middle of the cell
+
+   ld a,b
+   inc a
+   call hori_line_cell
+   ld a,(hl)
+   cp 'x'
+   jr nz, down_open
+
+   ld a,(_game + GAME_MUNCHKIN_Y)
+   ld e,a
+   ld d,0
+   ld hl,_game + GAME_SPEED
+   ld l,(hl)
+   ld h,d
+   add hl,de                   ; hl = y + speed
+   call cell_y_pixel           ; de = 40 + cell_y * 16
+   ex de,hl
+   or a
+   sbc hl,de
+   ret m
+
+down_open:
+
+   call in_tunnel
+   ret z
+
+   ld a,(_game + GAME_SPEED)
+   ld hl,_game + GAME_MUNCHKIN_Y
+   add a,(hl)
+   ld (hl),a
+   ld a,DOWN
+   jr manual_store
+
+manual_up:
+
+   ld a,b
+   call hori_line_cell
+   ld a,(hl)
+   cp 'x'
+   jr nz, up_open
+
+   ld a,(_game + GAME_MUNCHKIN_Y)
+   ld l,a
+   ld h,0
+   ld a,(_game + GAME_SPEED)
+   ld e,a
+   ld d,h
+   or a
+   sbc hl,de                   ; hl = y - speed
+   call cell_y_pixel
+   or a
+   sbc hl,de
+   ret m
+
+up_open:
+
+   call in_tunnel
+   ret z
+
+   ld a,(_game + GAME_SPEED)
+   ld e,a
+   ld hl,_game + GAME_MUNCHKIN_Y
+   ld a,(hl)
+   sub e
+   ld (hl),a
+   ld a,UP
+
+manual_store:
+
+   ld (_game + GAME_AUTO_DIRECTION),a
+   ld (_game + GAME_LAST_DIRECTION),a
+   ret
+
+manual_left:
+
+   call vert_line_cell
+   ld a,(hl)
+   cp '|'
+   jr nz, left_open
+
+   ld a,(_game + GAME_MUNCHKIN_X)
+   ld l,a
+   ld h,0
+   ld a,(_game + GAME_SPEED)
+   ld e,a
+   ld d,h
+   or a
+   sbc hl,de                   ; hl = x - speed
+   call cell_x_pixel
+   or a
+   sbc hl,de
+   jp m, wrap_left
+
+left_open:
+
+   call may_turn
+   jr nz, wrap_left
+
+   ld a,(_game + GAME_SPEED)
+   ld e,a
+   ld hl,_game + GAME_MUNCHKIN_X
+   ld a,(hl)
+   sub e
+   ld (hl),a
+   ld a,LEFT
+   ld (_game + GAME_AUTO_DIRECTION),a
+   ld (_game + GAME_LAST_DIRECTION),a
+
+wrap_left:
+
+   ld hl,_game + GAME_MUNCHKIN_X
+   ld a,(hl)
+   cp 4
+   ret nc
+   ld (hl),252                 ; wrap screen left
+   ret
+
+manual_right:
+
+   call vert_line_cell
+   inc hl
+   ld a,(hl)
+   cp '|'
+   jr nz, right_open
+
+   ld a,(_game + GAME_MUNCHKIN_X)
+   ld e,a
+   ld d,0
+   ld hl,_game + GAME_SPEED
+   ld l,(hl)
+   ld h,d
+   add hl,de                   ; hl = x + speed
+   call cell_x_pixel
+   ex de,hl
+   or a
+   sbc hl,de
+   jp m, wrap_right
+
+right_open:
+
+   call may_turn
+   jr nz, wrap_right
+
+   ld a,(_game + GAME_SPEED)
+   ld hl,_game + GAME_MUNCHKIN_X
+   add a,(hl)
+   ld (hl),a
+   ld a,RIGHT
+   ld (_game + GAME_AUTO_DIRECTION),a
+   ld (_game + GAME_LAST_DIRECTION),a
+
+wrap_right:
+
+   ld hl,_game + GAME_MUNCHKIN_X
+   ld a,(hl)
+   cp 253
+   ret c
+   ld (hl),4                   ; wrap screen right
+   ret
+
+
+auto_move:
+
+   ; no key pressed: finish the move to the next cell boundary
+
+   ld a,(_game + GAME_AUTO_DIRECTION)
+   cp LEFT
+   jr z, auto_left
+   cp RIGHT
+   jr z, auto_right
+   cp UP
+   jr z, auto_up
+   cp DOWN
+   ret nz
+
+   ; auto down
+
+   call on_row
+   jr z, auto_stop
+   ld a,(_game + GAME_SPEED)
+   ld hl,_game + GAME_MUNCHKIN_Y
+   add a,(hl)
+   ld (hl),a
+   ld a,DOWN
+   ld (_game + GAME_LAST_DIRECTION),a
+   ret
+
+auto_up:
+
+   call on_row
+   jr z, auto_stop
+   ld a,(_game + GAME_SPEED)
+   ld e,a
+   ld hl,_game + GAME_MUNCHKIN_Y
+   ld a,(hl)
+   sub e
+   ld (hl),a
+   ld a,UP
+   ld (_game + GAME_LAST_DIRECTION),a
+   ret
+
+auto_left:
+
+   call on_column
+   jr z, auto_stop
+   ld a,LEFT
+   ld (_game + GAME_LAST_DIRECTION),a
+   ld a,(_game + GAME_SPEED)
+   ld e,a
+   ld hl,_game + GAME_MUNCHKIN_X
+   ld a,(hl)
+   sub e
+   ld (hl),a
+   cp 4
+   ret nc
+   ld (hl),252                 ; wrap screen left
+   ret
+
+auto_right:
+
+   call on_column
+   jr z, auto_stop
+   ld a,RIGHT
+   ld (_game + GAME_LAST_DIRECTION),a
+   ld a,(_game + GAME_SPEED)
+   ld hl,_game + GAME_MUNCHKIN_X
+   add a,(hl)
+   ld (hl),a
+   cp 253
+   ret c
+   ld (hl),4                   ; wrap screen right
+   ret
+
+auto_stop:
+
+   xor a
+   ld (_game + GAME_AUTO_DIRECTION),a
+   ret
+
+
+; helpers for move_munchkin
+
+vert_line_cell:
+
+   ; exit : hl = &vertical_lines[cell_y].line[cell_x]
+
+   ld l,b
+   ld h,0
+   ld e,l
+   ld d,h
+   add hl,hl
+   add hl,hl
+   add hl,de
+   add hl,hl
+   add hl,de                   ; hl = cell_y * 11
+   ld de,_game + GAME_VERTICAL_LINES
+   jr add_cell_x
+
+hori_line_cell:
+
+   ; enter: a = row (cell_y or cell_y + 1)
+   ; exit : hl = &horizontal_lines[row].line[cell_x]
+
+   ld l,a
+   ld h,0
+   ld e,l
+   ld d,h
+   add hl,hl
+   add hl,hl
+   add hl,de
+   add hl,hl                   ; hl = row * 10
+   ld de,_game + GAME_HORIZONTAL_LINES
+
+add_cell_x:
+
+   add hl,de
+   ld e,c
+   ld d,0
+   bit 7,c
+   jr z, add_cell_x_pos
+   dec d                       ; cell_x == -1
+
+add_cell_x_pos:
+
+   add hl,de
+   ret
+
+cell_x_pixel:
+
+   ; exit : de = 28 + cell_x * 24 (4 .. 244, also for cell_x == -1)
+
+   ld a,c
+   add a,a
+   add a,c
+   add a,a
+   add a,a
+   add a,a
+   add a,28
+   ld e,a
+   ld d,0
+   ret
+
+cell_y_pixel:
+
+   ; exit : de = 40 + cell_y * 16
+
+   ld a,b
+   add a,a
+   add a,a
+   add a,a
+   add a,a
+   add a,40
+   ld e,a
+   ld d,0
+   ret
+
+in_tunnel:
+
+   ; exit : z if the munchkin is in the tunnel (row 4, left or right of the maze)
+
+   ld a,b
+   cp 4
+   ret nz
+   ld a,(_game + GAME_MUNCHKIN_X)
+   cp 4
+   ret z
+   ld a,c
+   cp 9
+   ret
+
+may_turn:
+
+   ; exit : z if a horizontal move is allowed
+   ;        from a vertical move only on a row boundary,
+   ;        otherwise when moving horizontally or stopped
+
+   ld a,(_game + GAME_LAST_DIRECTION)
+   cp UP
+   jr z, may_turn_vertical
+   cp DOWN
+   jr z, may_turn_vertical
+   cp RIGHT + 1
+   jr nc, may_turn_no
+   xor a
+   ret
+
+may_turn_vertical:
+
+   call on_row
+   ret z
+
+may_turn_no:
+
+   or 1                        ; nz
+   ret
+
+on_row:
+
+   ; exit : z if (y - 40) % 16 == 0
+
+   ld a,(_game + GAME_MUNCHKIN_Y)
+   and $0f
+   cp 8
+   ret
+
+on_column:
+
+   ; exit : z if (x - 28) % 24 == 0
+
+   ld a,(_game + GAME_MUNCHKIN_X)
+
+on_column_loop:
+
+   cp 24
+   jr c, on_column_done
+   sub 24
+   jr on_column_loop
+
+on_column_done:
+
+   cp 4
+   ret
+
+ENDIF
@@ -0,0 +1,24 @@
+// host build of main.c (tools/hostbuild.py): the whole of main.c in the
+// driver, so the driver can use its globals and static functions
+
+#ifndef _HOST_GAME_H
+#define _HOST_GAME_H
+
+#include <stdint.h>
+#include <string.h>
+
+// clear_screen() and draw_menu() write the display file at 0x4000 and the
+// attributes at 0x5800 directly, there is nothing there on the host
+static void *host_memset(void *p, int c, size_t n)
+{
+   if ((uintptr_t)p < 0x10000) return p;
+   return memset(p, c, n);
+}
+
+#define memset host_memset
+#define main game_main
+#include "main.c"
+#undef main
+#undef memset
+
+#endif
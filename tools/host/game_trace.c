@@ -0,0 +1,142 @@
+// Trace of whole games in C for tools/trace.py: the real run_play() of
+// main.c, with a joystick that is a seeded random player. One line per step
+// (main loop pass), so two builds or two versions of main.c can be compared
+// with diff. At the end a summary of the sp1 work per step goes to stderr.
+//
+// usage: game_trace seed steps [ghosts]
+//
+// A step line:
+//   <step> M<x>,<y>,<auto>,<last> d<dying>,<munchkin frame> c<completed> s<score> p<active pills>
+//      G<x>,<y>,<status>,<colour> ... P<x>,<y>,<status>,<colour masked> ...
+//      | w<cells invalidated>,<sprite moves> k<sprite colours>,<screen> <events>
+// events: S:<sprite>:<frame>@<x>,<y> (sprite moved), H:<sprite> (hidden),
+//   B:<sound>, P:<row>,<col>:<attr> (string printed)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "host.h"
+#include "game.h"
+
+static unsigned int steps, step;
+static int last_frame;
+static unsigned char started;
+static unsigned long player = 1;          // the player's own random numbers, rand() is the game's
+static unsigned int hold;
+static uint16_t stick;
+static unsigned long cells_total, moves_total;
+static unsigned int cells_most, moves_most;
+
+const char *host_sprite_name(struct sp1_ss *s)
+{
+   static char name[8];
+   unsigned char k;
+
+   if (s == munchkin_sprite) return "M";
+   for (k = 0; k < NUM_GHOSTS; k++)
+      if (s == game.ghosts[k].sprite) {
+         sprintf(name, "G%u", k);
+         return name;
+      }
+   for (k = 0; k < NUM_PILLS; k++)
+      if (s == game.pills[k].sprite) {
+         sprintf(name, "P%u", k);
+         return name;
+      }
+   return "?";
+}
+
+// a frame by its first rows (the same graphic from any address gets the same name)
+const char *host_frame_name(void *frame)
+{
+   static char name[8];
+   unsigned char *p = frame;
+   unsigned int sum = 0, k;
+
+   if (p == NULL) return "-";
+   for (k = 0; k < 16; k++) sum = sum * 31 + p[k];
+   sprintf(name, "%04x", sum & 0xffff);
+   return name;
+}
+
+static unsigned int player_random(unsigned int n)
+{
+   player = player * 1103515245 + 12345;
+   return (player >> 16) % n;
+}
+
+// a direction (or none) held for a while, as a player does
+static uint16_t player_stick(udk_t *u)
+{
+   static const uint16_t sticks[] = { 0, IN_STICK_LEFT, IN_STICK_RIGHT, IN_STICK_UP, IN_STICK_DOWN };
+
+   if (hold == 0) {
+      stick = sticks[player_random(5)];
+      hold = 1 + player_random(24);
+   }
+   hold--;
+   return stick;
+}
+
+static void print_step(void)
+{
+   unsigned char k;
+
+   printf("%u M%u,%u,%u,%u d%u,%u c%u s%u p%u", step, game.munchkin_x_factor1, game.munchkin_y_factor1,
+          game.munchkin_auto_direction, game.munchkin_last_direction, game.munchkin_dying,
+          (unsigned int)(game.munchkin_anim.frame - game.munchkin_anim.sequence), game.maze_completed, game.score, game.active_pills);
+   for (k = 0; k < NUM_GHOSTS; k++)
+      printf(" G%u,%u,%u,%u", game.ghosts[k].x, game.ghosts[k].y, game.ghosts[k].status, game.ghosts[k].colour);
+   for (k = 0; k < NUM_PILLS; k++)
+      printf(" P%u,%u,%u,%u", game.pills[k].x, game.pills[k].y, game.pills[k].status, game.pills[k].colour_masked);
+   printf(" | w%u,%u k%08lx,%08lx%s\n", host_work.cells, host_work.moves, host_sprite_sum(), host_screen_sum(), host_events);
+
+   if (step != 0) {          // step 0 is the start of the game
+      cells_total += host_work.cells;
+      moves_total += host_work.moves;
+      if (host_work.cells > cells_most) cells_most = host_work.cells;
+      if (host_work.moves > moves_most) moves_most = host_work.moves;
+   }
+   host_work.cells = host_work.moves = 0;
+   host_clear_events();
+}
+
+// called at the start of every pass of the main loop (more than once with
+// GAME_SNAPSHOT), a new game.frame is a new step
+int in_inkey(void)
+{
+   if (started && game.frame == last_frame) return 0;
+   started = 1;
+   last_frame = game.frame;
+   print_step();
+   if (step++ == steps) return 12;          // backspace: end of the game
+   return 0;
+}
+
+int main(int argc, char **argv)
+{
+   unsigned int seed;
+
+   if (argc != 3 && argc != 4) {
+      fprintf(stderr, "usage: %s seed steps [ghosts]\n", argv[0]);
+      return 2;
+   }
+   seed = atoi(argv[1]);
+   steps = atoi(argv[2]);
+   if (argc == 4) NUM_GHOSTS = atoi(argv[3]);
+
+   setup();
+   srand(seed);
+   player = seed;
+   game.active_pills = NUM_PILLS;
+   joyfunc = (JOYFUNC)player_stick;
+   host_work.cells = host_work.moves = 0;
+   host_clear_events();
+
+   run_play();
+
+   fprintf(stderr, "%u steps, %u pills, %u ghosts: %.1f cells invalidated per step (most %u), "
+           "%.1f sprite moves per step (most %u)\n", steps, NUM_PILLS, NUM_GHOSTS,
+           steps ? (double)cells_total / steps : 0.0, cells_most,
+           steps ? (double)moves_total / steps : 0.0, moves_most);
+   return 0;
+}
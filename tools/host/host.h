@@ -0,0 +1,31 @@
+// host build of main.c (tools/hostbuild.py): what tools/host/stubs.c and
+// the drivers share
+
+#ifndef _HOST_H
+#define _HOST_H
+
+#include <arch/zx/sp1.h>
+
+// sp1 work in the current step, cleared by the driver
+typedef struct {
+   unsigned int cells;                 // update structs invalidated
+   unsigned int moves;                 // sprites moved
+} host_work_type;
+
+extern host_work_type host_work;
+
+// events of the current step (sprite moves, sounds, prints), one line
+extern char host_events[];
+void host_event(const char *format, ...);
+void host_clear_events(void);
+
+// checksums of the screen (colour and tile graphic of every cell) and of the
+// colours of the sprites, so colour and pill layer changes show up in traces
+unsigned long host_screen_sum(void);
+unsigned long host_sprite_sum(void);
+
+// names for the events, given by the driver
+const char *host_sprite_name(struct sp1_ss *s);
+const char *host_frame_name(void *frame);
+
+#endif
@@ -0,0 +1,9 @@
+// host stand-in for <alloc/balloc.h> (tools/hostbuild.py)
+
+#ifndef _HOST_BALLOC_H
+#define _HOST_BALLOC_H
+
+void balloc_reset(unsigned int q);
+void *balloc_addmem(unsigned int q, unsigned int num, unsigned int size, void *addr);
+
+#endif
@@ -0,0 +1,25 @@
+// host stand-in for <arch/zx.h> (tools/hostbuild.py)
+
+#ifndef _HOST_ARCH_ZX_H
+#define _HOST_ARCH_ZX_H
+
+#include <stdint.h>
+
+#define INK_BLACK      0x00
+#define INK_BLUE       0x01
+#define INK_RED        0x02
+#define INK_MAGENTA    0x03
+#define INK_GREEN      0x04
+#define INK_CYAN       0x05
+#define INK_YELLOW     0x06
+#define INK_WHITE      0x07
+
+#define PAPER_BLACK    0x00
+#define PAPER_WHITE    0x38
+
+#define BRIGHT         0x40
+#define FLASH          0x80
+
+void zx_border(unsigned char colour);
+
+#endif
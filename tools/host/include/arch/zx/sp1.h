@@ -0,0 +1,83 @@
+// host stand-in for <arch/zx/sp1.h> (tools/hostbuild.py): the structs and
+// calls main.c uses, done by tools/host/stubs.c
+//
+// tile is an unsigned int here, main.c keeps pointers in it (the host build
+// is linked -no-pie, so they fit)
+
+#ifndef _HOST_SP1_H
+#define _HOST_SP1_H
+
+#include <stdint.h>
+
+struct sp1_Rect {
+   uint8_t row, col, width, height;
+};
+
+struct sp1_cs {
+   uint8_t unused[8];
+   uint8_t attr_mask;
+   uint8_t attr;
+};
+
+struct sp1_ss {
+   uint8_t row, col, width, height;
+   uint8_t vrot, hrot;
+   void *frame;
+   struct sp1_cs cs[4];                 // 2 x 2 chars, in sp1_IterateSprChar() order
+};
+
+struct sp1_pss {
+   struct sp1_Rect *bounds;
+   uint8_t flags;
+   uint8_t row, col;
+   uint8_t attr_mask, attr;
+   void *pos;
+   void *visit;
+};
+
+struct sp1_update {
+   uint8_t nload;
+   uint8_t colour;
+   unsigned int tile;
+   void *slist;
+   void *ulist;
+   uint8_t *screen;
+};
+
+extern char SP1_DRAW_MASK2LB[];
+extern char SP1_DRAW_MASK2RB[];
+extern char SP1_DRAW_MASK2[];
+extern char SP1_DRAW_MASK2NR[];
+
+#define SP1_TYPE_2BYTE               0x40
+#define SP1_AMASK_INK                0xf8
+#define SP1_RFLAG_TILE               0x01
+#define SP1_RFLAG_COLOUR             0x02
+#define SP1_PSSFLAG_INVALIDATE       0x01
+#define SP1_IFLAG_MAKE_ROTTBL        0x01
+#define SP1_IFLAG_OVERWRITE_TILES    0x02
+#define SP1_IFLAG_OVERWRITE_DFILE    0x04
+
+struct sp1_ss *sp1_CreateSpr(void *drawf, uint8_t type, uint8_t height, int graphic, uint8_t plane);
+uint8_t sp1_AddColSpr(struct sp1_ss *s, void *drawf, uint8_t type, int graphic, uint8_t plane);
+void sp1_DeleteSpr(struct sp1_ss *s);
+void sp1_MoveSprPix(struct sp1_ss *s, struct sp1_Rect *clip, void *frame, uint16_t x, uint16_t y);
+void sp1_MoveSprAbs(struct sp1_ss *s, struct sp1_Rect *clip, void *frame, uint8_t row, uint8_t col, uint8_t vrot, uint8_t hrot);
+void sp1_IterateSprChar(struct sp1_ss *s, void *hook);
+void sp1_IterateUpdateRect(struct sp1_Rect *r, void *hook);
+void *sp1_TileEntry(uint16_t c, void *def);
+void sp1_PrintAt(uint8_t row, uint8_t col, uint16_t colour, uint16_t tile);
+void sp1_PrintAtInv(uint8_t row, uint8_t col, uint16_t colour, uint16_t tile);
+void sp1_SetPrintPos(struct sp1_pss *ps, uint8_t row, uint8_t col);
+void sp1_PrintString(struct sp1_pss *ps, void *s);
+void sp1_ClearRect(struct sp1_Rect *r, uint8_t colour, uint8_t tile, uint8_t rflag);
+void sp1_ClearRectInv(struct sp1_Rect *r, uint8_t colour, uint8_t tile, uint8_t rflag);
+void sp1_Invalidate(struct sp1_Rect *r);
+void sp1_Validate(struct sp1_Rect *r);
+void sp1_InvUpdateStruct(struct sp1_update *u);
+void sp1_ValUpdateStruct(struct sp1_update *u);
+struct sp1_update *sp1_GetUpdateStruct(uint8_t row, uint8_t col);
+void sp1_UpdateNow(void);
+void sp1_Initialize(uint8_t iflag, uint8_t colour, uint8_t tile);
+
+#endif
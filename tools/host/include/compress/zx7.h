@@ -0,0 +1,8 @@
+// host stand-in for <compress/zx7.h> (tools/hostbuild.py)
+
+#ifndef _HOST_ZX7_H
+#define _HOST_ZX7_H
+
+void dzx7_standard(void *src, void *dst);
+
+#endif
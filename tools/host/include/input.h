@@ -0,0 +1,28 @@
+// host stand-in for <input.h> (tools/hostbuild.py), the joystick is set by the driver
+
+#ifndef _HOST_INPUT_H
+#define _HOST_INPUT_H
+
+#include <stdint.h>
+
+typedef struct {
+   uint16_t fire, right, left, down, up;
+} udk_t;
+
+typedef uint16_t (*JOYFUNC)(udk_t *);
+
+#define IN_STICK_FIRE    0x80
+#define IN_STICK_UP      0x08
+#define IN_STICK_DOWN    0x04
+#define IN_STICK_LEFT    0x02
+#define IN_STICK_RIGHT   0x01
+
+int in_inkey(void);
+void in_wait_key(void);
+void in_wait_nokey(void);
+uint16_t in_key_scancode(int c);
+uint16_t in_stick_keyboard(udk_t *u);
+uint16_t in_stick_kempston(udk_t *u);
+uint16_t in_stick_sinclair1(udk_t *u);
+
+#endif
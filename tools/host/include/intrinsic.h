@@ -0,0 +1,10 @@
+// host stand-in for <intrinsic.h> (tools/hostbuild.py)
+
+#ifndef _HOST_INTRINSIC_H
+#define _HOST_INTRINSIC_H
+
+void intrinsic_halt(void);
+void intrinsic_ei(void);
+void intrinsic_di(void);
+
+#endif
@@ -0,0 +1,16 @@
+// host stand-in for <sound.h> (tools/hostbuild.py): the beepfx effects main.c uses
+
+#ifndef _HOST_SOUND_H
+#define _HOST_SOUND_H
+
+extern char BEEPFX_PICK[];
+extern char BEEPFX_HIT_2[];
+extern char BEEPFX_GULP[];
+extern char BEEPFX_ITEM_3[];
+extern char BEEPFX_POWER_OFF[];
+extern char BEEPFX_FAT_BEEP_1[];
+extern char BEEPFX_JUMP_2[];
+
+void bit_beepfx_di(void *effect);
+
+#endif
@@ -0,0 +1,103 @@
+// Traces of the movement kernels in C (move_munchkin() and move_actor() in
+// main.c) for tools/test_move.py, which runs move.asm through the same steps.
+//
+// usage: move_trace seed traces steps
+//
+// Output, one line each:
+//   V <bytes>                      vertical_lines of the maze (and center rotation) below
+//   H <bytes>                      horizontal_lines
+//   M <x> <y> <speed> <auto> <last>       munchkin trace from this state
+//   m <key> <x> <y> <auto> <last>         a step: key (0 = none), state after it
+//   A <x> <y> <direction> <speed> <countdown>   actor trace from this state
+//   a <direction> <countdown> <x> <y> <countdown>   a step: direction and countdown set
+//                                  before it (as at a node), state after it
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "host.h"
+#include "game.h"
+
+const char *host_sprite_name(struct sp1_ss *s) { return "-"; }
+const char *host_frame_name(void *frame) { return "-"; }
+int in_inkey(void) { return 0; }
+
+static void print_lines(void)
+{
+   unsigned int k;
+
+   printf("V");
+   for (k = 0; k < sizeof(game.vertical_lines); k++) printf(" %u", ((unsigned char *)game.vertical_lines)[k]);
+   printf("\nH");
+   for (k = 0; k < sizeof(game.horizontal_lines); k++) printf(" %u", ((unsigned char *)game.horizontal_lines)[k]);
+   printf("\n");
+}
+
+// a start on a crossing of the lanes (x = 28 + 24 * cell_x, y = 40 + 16 * cell_y),
+// from there the steps only reach places the game can reach too
+static void munchkin_start(void)
+{
+   game.munchkin_x_factor1 = 28 + 24 * (rand() % NUM_HORI_CELLS);
+   game.munchkin_y_factor1 = 40 + 16 * (rand() % NUM_VERT_CELLS);
+   game.speed = 1 + rand() % 2;              // 1 or 2, as in the game
+   game.munchkin_auto_direction = rand() % 5;
+   game.munchkin_last_direction = rand() % 5;
+}
+
+int main(int argc, char **argv)
+{
+   unsigned int seed, traces, steps, t, n, hold;
+   unsigned char maze, center, key;
+   actor_type a;
+
+   if (argc != 4) {
+      fprintf(stderr, "usage: %s seed traces steps\n", argv[0]);
+      return 2;
+   }
+   seed = atoi(argv[1]);
+   traces = atoi(argv[2]);
+   steps = atoi(argv[3]);
+   srand(seed);
+
+   for (maze = 1; maze <= 2; maze++) {
+      game.maze_selected = maze;
+      setup_maze();
+      for (center = 1; center <= 4; center++) {
+         set_maze_center_walls(center);
+         print_lines();
+         for (t = 0; t < traces; t++) {
+            munchkin_start();
+            printf("M %u %u %u %u %u\n", game.munchkin_x_factor1, game.munchkin_y_factor1, game.speed,
+                   game.munchkin_auto_direction, game.munchkin_last_direction);
+            key = 0;
+            hold = 0;
+            for (n = 0; n < steps; n++) {
+               if (hold == 0) {            // a key (or none) held for a while, as a player does
+                  key = rand() % 5;
+                  hold = 1 + rand() % 24;
+               }
+               hold--;
+               move_munchkin(key);
+               printf("m %u %u %u %u %u\n", key, game.munchkin_x_factor1, game.munchkin_y_factor1,
+                      game.munchkin_auto_direction, game.munchkin_last_direction);
+            }
+         }
+      }
+   }
+
+   for (t = 0; t < traces * 8; t++) {
+      a.x = rand() % 256;
+      a.y = rand() % 256;
+      a.direction = rand() % 5;
+      a.speed = rand() % 4;
+      a.countdown = rand() % 3 ? rand() % 256 : 0;
+      printf("A %u %u %u %u %u\n", a.x, a.y, a.direction, a.speed, a.countdown);
+      for (n = 0; n < steps; n++) {
+         if (rand() % 8 == 0) a.direction = rand() % 5;     // a new direction at a node
+         if (a.countdown == 0 && rand() % 2) a.countdown = rand() % 64;
+         printf("a %u %u", a.direction, a.countdown);
+         move_actor(&a);
+         printf(" %u %u %u\n", a.x, a.y, a.countdown);
+      }
+   }
+   return 0;
+}
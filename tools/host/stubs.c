@@ -0,0 +1,302 @@
+// host build of main.c (tools/hostbuild.py): what the z88dk libraries, int.c
+// and the assembly sources do on the Spectrum, as far as the game logic needs
+// it. Nothing is drawn, sprite moves, sounds and prints are logged as events
+// and the sp1 update structs are counted when invalidated.
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <arch/zx.h>
+#include <arch/zx/sp1.h>
+#include <alloc/balloc.h>
+#include <input.h>
+#include <intrinsic.h>
+#include <sound.h>
+#include "host.h"
+
+#define MAX_SPRITES    64
+#define EVENTS_SIZE    16384
+
+host_work_type host_work;
+char host_events[EVENTS_SIZE];
+static unsigned int events_len;
+
+void host_event(const char *format, ...)
+{
+   va_list args;
+
+   if (events_len > EVENTS_SIZE - 64) return;
+   va_start(args, format);
+   events_len += vsnprintf(host_events + events_len, EVENTS_SIZE - events_len, format, args);
+   va_end(args);
+}
+
+void host_clear_events(void)
+{
+   events_len = 0;
+   host_events[0] = 0;
+}
+
+
+// assembly sources and int.c
+
+unsigned char TEMPMEM[1024];
+unsigned char blocks_used, blocks_peak;
+unsigned int tick, timer;
+
+char SP1_DRAW_MASK2LB[1], SP1_DRAW_MASK2RB[1], SP1_DRAW_MASK2[1], SP1_DRAW_MASK2NR[1];
+char BEEPFX_PICK[1], BEEPFX_HIT_2[1], BEEPFX_GULP[1], BEEPFX_ITEM_3[1], BEEPFX_POWER_OFF[1], BEEPFX_FAT_BEEP_1[1], BEEPFX_JUMP_2[1];
+
+#ifndef WFRAMES
+#define WFRAMES        1
+#endif
+
+unsigned char wait(void)
+{
+   tick += WFRAMES;
+   return WFRAMES;
+}
+
+void setup_int(void) {}
+void playfx(unsigned int fx) {}
+
+
+// z88dk libraries
+
+void zx_border(unsigned char colour) {}
+void intrinsic_halt(void) { tick++; }
+void intrinsic_ei(void) {}
+void intrinsic_di(void) {}
+
+void balloc_reset(unsigned int q) {}
+void *balloc_addmem(unsigned int q, unsigned int num, unsigned int size, void *addr) { return addr; }
+void dzx7_standard(void *src, void *dst) {}
+
+void in_wait_key(void) {}
+void in_wait_nokey(void) {}
+uint16_t in_key_scancode(int c) { return 0; }
+uint16_t in_stick_keyboard(udk_t *u) { return 0; }
+uint16_t in_stick_kempston(udk_t *u) { return 0; }
+uint16_t in_stick_sinclair1(udk_t *u) { return 0; }
+
+void bit_beepfx_di(void *effect)
+{
+   static const struct { char *effect; const char *name; } names[] = {
+      { BEEPFX_PICK, "pick" }, { BEEPFX_HIT_2, "hit_2" }, { BEEPFX_GULP, "gulp" }, { BEEPFX_ITEM_3, "item_3" },
+      { BEEPFX_POWER_OFF, "power_off" }, { BEEPFX_FAT_BEEP_1, "fat_beep_1" }, { BEEPFX_JUMP_2, "jump_2" }
+   };
+   unsigned int k;
+
+   for (k = 0; k < sizeof(names) / sizeof(names[0]); k++)
+      if (names[k].effect == effect) host_event(" B:%s", names[k].name);
+}
+
+
+// sp1: sprites are only positions, the update structs have a tile and a colour
+
+static struct sp1_ss sprites[MAX_SPRITES];
+static unsigned char sprite_used[MAX_SPRITES];
+static struct sp1_update cells[24][32];
+static void *tile_graphic[256];
+static unsigned char blank_tile[8];
+
+void sp1_Initialize(uint8_t iflag, uint8_t colour, uint8_t tile)
+{
+   unsigned int r, c;
+
+   for (r = 0; r < 24; r++)
+      for (c = 0; c < 32; c++) {
+         cells[r][c].colour = colour;
+         cells[r][c].tile = (unsigned int)(uintptr_t)blank_tile;
+      }
+   for (r = 0; r < 256; r++) tile_graphic[r] = blank_tile;
+}
+
+struct sp1_ss *sp1_CreateSpr(void *drawf, uint8_t type, uint8_t height, int graphic, uint8_t plane)
+{
+   unsigned int k;
+
+   for (k = 0; k < MAX_SPRITES; k++)
+      if (!sprite_used[k]) {
+         sprite_used[k] = 1;
+         memset(&sprites[k], 0, sizeof(sprites[k]));
+         return &sprites[k];
+      }
+   fprintf(stderr, "host: out of sprites\n");
+   return NULL;
+}
+
+uint8_t sp1_AddColSpr(struct sp1_ss *s, void *drawf, uint8_t type, int graphic, uint8_t plane) { return 1; }
+
+void sp1_DeleteSpr(struct sp1_ss *s)
+{
+   sprite_used[s - sprites] = 0;
+}
+
+void sp1_MoveSprPix(struct sp1_ss *s, struct sp1_Rect *clip, void *frame, uint16_t x, uint16_t y)
+{
+   if (frame != NULL) s->frame = frame;
+   s->row = y >> 3;
+   s->col = x >> 3;
+   host_work.moves++;
+   host_event(" S:%s:%s@%u,%u", host_sprite_name(s), host_frame_name(s->frame), x, y);
+}
+
+void sp1_MoveSprAbs(struct sp1_ss *s, struct sp1_Rect *clip, void *frame, uint8_t row, uint8_t col, uint8_t vrot, uint8_t hrot)
+{
+   if (frame != NULL) s->frame = frame;
+   s->row = row;
+   s->col = col;
+   host_work.moves++;
+   if (col >= 32) host_event(" H:%s", host_sprite_name(s));
+      else host_event(" S:%s:%s@%u,%u", host_sprite_name(s), host_frame_name(s->frame), col * 8, row * 8);
+}
+
+void sp1_IterateSprChar(struct sp1_ss *s, void *hook)
+{
+   unsigned int k;
+
+   for (k = 0; k < 4; k++) ((void (*)(unsigned int, struct sp1_cs *))hook)(k, &s->cs[k]);
+}
+
+void sp1_IterateUpdateRect(struct sp1_Rect *r, void *hook)
+{
+   unsigned int row, col;
+
+   for (row = r->row; row < r->row + r->height && row < 24; row++)
+      for (col = r->col; col < r->col + r->width && col < 32; col++)
+         ((void (*)(struct sp1_update *))hook)(&cells[row][col]);
+}
+
+void *sp1_TileEntry(uint16_t c, void *def)
+{
+   void *old = tile_graphic[c & 0xff];
+
+   tile_graphic[c & 0xff] = def;
+   return old;
+}
+
+static void invalidate(struct sp1_Rect *r)
+{
+   host_work.cells += r->width * r->height;
+}
+
+// the tile graphic in place of the tile code: on the host there is no tile array
+// at SP1_TILE_ARRAY for the pill layer to look the code up in
+void sp1_PrintAt(uint8_t row, uint8_t col, uint16_t colour, uint16_t tile)
+{
+   cells[row][col].colour = colour;
+   cells[row][col].tile = (unsigned int)(uintptr_t)tile_graphic[tile & 0xff];
+}
+
+void sp1_PrintAtInv(uint8_t row, uint8_t col, uint16_t colour, uint16_t tile)
+{
+   sp1_PrintAt(row, col, colour, tile);
+   host_work.cells++;
+}
+
+void sp1_SetPrintPos(struct sp1_pss *ps, uint8_t row, uint8_t col)
+{
+   ps->row = row;
+   ps->col = col;
+}
+
+// the print codes of the game screen: 0x0d new line, 0x0e n ... 0x0f n times,
+// 0x14 attr and 0x16 row col; text (below 0x80) goes into the event as well
+void sp1_PrintString(struct sp1_pss *ps, void *s)
+{
+   unsigned char *p = s, *repeat = NULL, count = 0;
+   char text[33];
+   unsigned int len = 0;
+
+   host_event(" P:%u,%u:", ps->row, ps->col);
+   while (*p != 0) {
+      if (*p == 0x0d) {
+         ps->row++;
+         ps->col = ps->bounds->col;
+      } else if (*p == 0x0e) {
+         count = *++p;
+         repeat = p;
+      } else if (*p == 0x0f) {
+         if (--count != 0) p = repeat;
+      } else if (*p == 0x14) {
+         ps->attr = *++p;
+      } else if (*p == 0x16) {
+         ps->row = *++p;
+         ps->col = *++p;
+      } else if (*p < 0x20) {
+         fprintf(stderr, "host: print code 0x%02x not done\n", *p);
+         exit(1);
+      } else {
+         if (ps->row < 24 && ps->col < 32) {
+            sp1_PrintAt(ps->row, ps->col, ps->attr, *p);
+            if (ps->flags & SP1_PSSFLAG_INVALIDATE) host_work.cells++;
+         }
+         if (*p < 0x80 && len < 32) text[len++] = *p;
+         ps->col++;
+      }
+      p++;
+   }
+   text[len] = 0;
+   host_event("%02x:%s", ps->attr, text);
+}
+
+void sp1_ClearRect(struct sp1_Rect *r, uint8_t colour, uint8_t tile, uint8_t rflag) {}
+
+void sp1_ClearRectInv(struct sp1_Rect *r, uint8_t colour, uint8_t tile, uint8_t rflag)
+{
+   invalidate(r);
+}
+
+void sp1_Invalidate(struct sp1_Rect *r)
+{
+   invalidate(r);
+}
+
+void sp1_Validate(struct sp1_Rect *r) {}
+
+void sp1_InvUpdateStruct(struct sp1_update *u)
+{
+   host_work.cells++;
+}
+
+void sp1_ValUpdateStruct(struct sp1_update *u) {}
+
+struct sp1_update *sp1_GetUpdateStruct(uint8_t row, uint8_t col)
+{
+   return &cells[row][col];
+}
+
+void sp1_UpdateNow(void) {}
+
+
+// checksums (host.h)
+
+unsigned long host_screen_sum(void)
+{
+   unsigned long sum = 0;
+   unsigned int r, c, k;
+   unsigned char *graphic;
+
+   for (r = 0; r < 24; r++)
+      for (c = 0; c < 32; c++) {
+         graphic = (unsigned char *)(uintptr_t)cells[r][c].tile;
+         if (cells[r][c].tile < 0x100) graphic = tile_graphic[cells[r][c].tile];   // a tile code (unpack_maze())
+         sum = sum * 31 + cells[r][c].colour;
+         for (k = 0; k < 8; k++) sum = sum * 31 + graphic[k];
+      }
+   return sum & 0xffffffff;
+}
+
+unsigned long host_sprite_sum(void)
+{
+   unsigned long sum = 0;
+   unsigned int s, k;
+
+   for (s = 0; s < MAX_SPRITES; s++)
+      if (sprite_used[s])
+         for (k = 0; k < 4; k++) sum = sum * 31 + (sprites[s].cs[k].attr_mask << 8 | sprites[s].cs[k].attr);
+   return sum & 0xffffffff;
+}
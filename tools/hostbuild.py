@@ -0,0 +1,124 @@
+#!/usr/bin/env python
+
+# Host build of src/main.c for the checks in tools/ (test_move.py, trace.py).
+# main.c is compiled by gcc together with a driver from tools/host/, against
+# the stand-in z88dk headers in tools/host/include. tools/host/stubs.c does
+# the library calls. The gfx/*.asm sources of GFX.lst are converted to GNU
+# as, so the sprite frames and tiles are the real ones.
+#
+# The result is linked -no-pie: main.c keeps pointers in 16 bit tile fields
+# (the stand-in sp1_update has an unsigned int there), so the globals have to
+# be below 4 GB.
+#
+# Builds that need the Spectrum itself are refused: ZX128 (ram banks),
+# MEMORY_STATS (fixed addresses), ASM_MOVEMENT (move.asm, see test_move.py)
+# and PACKED_MAZES with the pill layer (tile codes looked up in the tile
+# array at SP1_TILE_ARRAY).
+
+from argparse import ArgumentParser
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+__version__ = "1.0"
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+HOST = os.path.join(ROOT, "tools", "host")
+
+UNSUPPORTED = ("ZX128", "MEMORY_STATS", "ASM_MOVEMENT")
+
+
+def value(token):
+    # a z80asm number: @binary, $hex, 0xhex, decimal or 'c'
+    token = token.strip()
+    if token.startswith("@"):
+        return int(token[1:], 2)
+    if token.startswith("$"):
+        return int(token[1:], 16)
+    if len(token) == 3 and token[0] == token[2] == "'":
+        return ord(token[1])
+    return int(token, 0)
+
+
+def convert(name, defines):
+    # a z80asm data source (defb, labels, IFDEF) as GNU as
+    out = []
+    skip = []
+    with open(name, "r") as fd:
+        for line in fd:
+            code = line.split(";")[0].strip()
+            if not code:
+                continue
+            word = code.split()
+            if word[0] in ("IFDEF", "IFNDEF"):
+                skip.append((word[1] in defines) != (word[0] == "IFDEF"))
+            elif word[0] == "ELSE":
+                skip[-1] = not skip[-1]
+            elif word[0] == "ENDIF":
+                skip.pop()
+            elif any(skip) or word[0] in ("SECTION", "EXTERN", "BINARY"):
+                continue
+            elif word[0] == "PUBLIC":
+                out.append("\t.globl %s" % word[1].lstrip("_"))
+            elif re.match(r"^\._\w+$", code) or re.match(r"^_\w+:$", code):
+                out.append("%s:" % code.lstrip("._").rstrip(":"))
+            elif word[0] in ("defb", "defm"):
+                out.append("\t.byte " + ", ".join("%d" % (value(v) & 0xff) for v in code[4:].split(",")))
+            elif word[0] == "defw":
+                out.append("\t.short " + ", ".join("%d" % (value(v) & 0xffff) for v in code[4:].split(",")))
+            else:
+                sys.exit("ERROR: %s: %s not supported" % (name, code))
+    return out
+
+
+def gfx_source(defines):
+    out = ["\t.data"]
+    with open(os.path.join(ROOT, "gfx", "GFX.lst"), "r") as fd:
+        for name in fd.read().split():
+            out += convert(os.path.join(ROOT, "gfx", name + ".asm"), defines)
+    out.append("\t.section .note.GNU-stack,\"\",@progbits")
+    return "\n".join(out) + "\n"
+
+
+def build(driver, defines, output):
+    # defines: ["NAME", "NAME=VALUE", ...] as for zcc -D
+    names = set(d.split("=")[0] for d in defines)
+    for name in UNSUPPORTED:
+        if name in names:
+            sys.exit("ERROR: the host build can't do %s" % name)
+    if "PACKED_MAZES" in names and ("PILL_LAYER" in names or "PILL_STORM" in names):
+        sys.exit("ERROR: the host build can't do PACKED_MAZES with the pill layer")
+
+    fd, gfx = tempfile.mkstemp(suffix=".s")
+    with os.fdopen(fd, "w") as f:
+        f.write(gfx_source(names))
+    try:
+        command = ["gcc", "-no-pie", "-O1", "-w", "-U_FORTIFY_SOURCE",
+                   "-D__z88dk_fastcall=", "-D__z88dk_callee=",
+                   "-I" + os.path.join(HOST, "include"), "-I" + HOST, "-I" + os.path.join(ROOT, "src")]
+        command += ["-D" + d for d in defines]
+        command += [os.path.join(HOST, driver), os.path.join(HOST, "stubs.c"), gfx, "-o", output]
+        if subprocess.call(command) != 0:
+            sys.exit("ERROR: host build of %s failed" % driver)
+    finally:
+        os.remove(gfx)
+
+
+def main():
+
+    parser = ArgumentParser(description="Build src/main.c with a driver from tools/host/ for the host")
+
+    parser.add_argument("--version", action="version", version="%(prog)s "  + __version__)
+    parser.add_argument("-D", dest="defines", action="append", default=[], metavar="NAME[=VALUE]",
+                        help="build option, as on the zcc line")
+    parser.add_argument("driver", help="driver in tools/host/ (game_trace.c, move_trace.c)")
+    parser.add_argument("output", help="program to write")
+
+    args = parser.parse_args()
+
+    build(args.driver, args.defines, args.output)
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,97 @@
+#!/usr/bin/env python
+
+# Memory budget of the 48K build, read from the map file made by zcc -m
+# (called by build.sh after every build)
+
+from argparse import ArgumentParser
+import re
+import sys
+
+__version__ = "1.0"
+
+TEMPMEM = 0x5e24            # 1024 bytes scratch ram, see src/main.asm
+STACK = 0xce00              # 512 bytes stack below REGISTER_SP = 0xd000 (zpragma.inc)
+IM2_TABLE = 0xd000          # 257 bytes, see src/int.c
+BALLOC_HIGH = 0xd101        # 208 free bytes, 8 balloc blocks of 25 bytes (setup in main.c)
+IM2_JUMP = 0xd1d1           # jp to the isr
+STATS = 0xd1d4              # 25 free bytes, memory stats in the MEMORY_STATS build
+SP1_TABLES = 0xd1ed         # sp1 default memory map up to 0xffff
+                            # (update list, buffers, update array, tile array, rotation tables)
+BLOCK_SIZE = 25             # 24 + 1 balloc overhead
+BANK_WINDOW = 0xc000        # 128K build: ram banks are paged in here
+BANK_COPY_SIZE = 80         # bytes of bank_copy (src/bank.asm), must stay below BANK_WINDOW
+
+
+def read_map(name):
+    symbols = {}
+    with open(name, "r") as fd:
+        for line in fd:
+            m = re.match(r"^(\S+)\s*=\s*\$([0-9A-Fa-f]+)\s*;\s*(\w+)", line)
+            if m:
+                symbols[m.group(1)] = (int(m.group(2), 16), m.group(3))
+    return symbols
+
+
+def main():
+
+    parser = ArgumentParser(description="Memory budget report from a z88dk map file")
+
+    parser.add_argument("--version", action="version", version="%(prog)s "  + __version__)
+    parser.add_argument("--org", dest="org", default=25124, type=int,
+                        help="CRT_ORG_CODE (default: 25124)")
+    parser.add_argument("map", help="map file (zcc -m)")
+
+    args = parser.parse_args()
+
+    symbols = read_map(args.map)
+
+    # sections: z80asm defines __<section>_head and __<section>_size
+    sizes = {"code": 0, "rodata": 0, "data": 0, "bss": 0}
+    end = args.org
+    for name, (value, kind) in symbols.items():
+        m = re.match(r"^__((code|rodata|data|bss)_\w+)_head$", name)
+        if not m or "__%s_size" % m.group(1) not in symbols:
+            continue
+        size = symbols["__%s_size" % m.group(1)][0]
+        if size == 0 or value < args.org or value >= STACK:
+            continue
+        sizes[m.group(2)] += size
+        end = max(end, value + size)
+
+    # size of the balloc pool in bss: distance to the next symbol
+    addrs = sorted(set(v for v, k in symbols.values() if k == "addr"))
+    pool = 0
+    if "_block_of_ram" in symbols:
+        start = symbols["_block_of_ram"][0]
+        following = [a for a in addrs if a > start]
+        if following:
+            pool = following[0] - start
+
+    free = STACK - end
+
+    print("memory map")
+    print("  $%04x - $%04x  %5d  TEMPMEM (per maze arena)" % (TEMPMEM, args.org - 1, args.org - TEMPMEM))
+    print("  $%04x - $%04x  %5d  program" % (args.org, end - 1, end - args.org))
+    print("                   %5d    code" % sizes["code"])
+    print("                   %5d    rodata" % sizes["rodata"])
+    print("                   %5d    data" % sizes["data"])
+    print("                   %5d    bss (balloc pool %d bytes, %d blocks)" % (sizes["bss"], pool, pool // BLOCK_SIZE))
+    if free >= 0:
+        print("  $%04x - $%04x  %5d  free" % (end, STACK - 1, free))
+    print("  $%04x - $%04x  %5d  stack" % (STACK, IM2_TABLE - 1, IM2_TABLE - STACK))
+    print("  $%04x - $%04x  %5d  im2 table" % (IM2_TABLE, BALLOC_HIGH - 1, BALLOC_HIGH - IM2_TABLE))
+    print("  $%04x - $%04x  %5d  balloc (8 blocks)" % (BALLOC_HIGH, IM2_JUMP - 1, IM2_JUMP - BALLOC_HIGH))
+    print("  $%04x - $%04x  %5d  im2 jump" % (IM2_JUMP, STATS - 1, STATS - IM2_JUMP))
+    print("  $%04x - $%04x  %5d  free (memory stats)" % (STATS, SP1_TABLES - 1, SP1_TABLES - STATS))
+    print("  $%04x - $ffff  %5d  sp1 tables" % (SP1_TABLES, 0x10000 - SP1_TABLES))
+
+    if free < 0:
+        print("ERROR: program overlaps the stack by %d bytes" % -free)
+        sys.exit(1)
+
+    if "_bank_copy" in symbols and symbols["_bank_copy"][0] + BANK_COPY_SIZE > BANK_WINDOW:
+        print("ERROR: bank_copy at $%04x is paged out with the bank, it must be below $%04x" % (symbols["_bank_copy"][0], BANK_WINDOW))
+        sys.exit(1)
+
+if __name__ == "__main__":
+    main()
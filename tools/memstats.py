@@ -0,0 +1,39 @@
+#!/usr/bin/env python
+
+# Read the memory stats of the MEMORY_STATS build from a 48K .sna snapshot
+# (saved in an emulator after returning to the menu)
+
+from argparse import ArgumentParser
+import struct
+import sys
+
+__version__ = "1.0"
+
+STATS = 0xd1d4              # memory_stats in src/main.c
+SNA_HEADER = 27             # 48K .sna: 27 byte header, then ram from 0x4000
+
+
+def main():
+
+    parser = ArgumentParser(description="Memory stats from a 48K .sna snapshot")
+
+    parser.add_argument("--version", action="version", version="%(prog)s "  + __version__)
+    parser.add_argument("file", help="snapshot (.sna)")
+
+    args = parser.parse_args()
+
+    with open(args.file, "rb") as fd:
+        data = bytearray(fd.read())
+
+    offset = SNA_HEADER + STATS - 0x4000
+    magic, stack_peak, blocks_peak, blocks_low = struct.unpack("<2sHBB", bytes(data[offset:offset + 6]))
+
+    if magic != b"MS":
+        print("no memory stats (not a MEMORY_STATS build, or the menu was not shown yet)")
+        sys.exit(1)
+
+    print("stack peak:  %d bytes (of 512)" % stack_peak)
+    print("sp1 blocks:  %d in use at the peak, %d left" % (blocks_peak, blocks_low))
+
+if __name__ == "__main__":
+    main()
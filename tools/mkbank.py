@@ -0,0 +1,90 @@
+#!/usr/bin/env python
+
+# Maze bank for the 128K build: the screen (ptiles) and tiles of every maze,
+# taken from the png2c.py output in gfx/, as one binary to load in a ram bank
+# at 0xc000 (see build.sh).
+#
+# At 0xc000 there is a directory with 6 bytes per maze, in the given order
+# (maze_pack_type in src/main.c):
+#   word: address of the screen, word: length of the screen, word: address of the tiles
+# followed by the data.
+# With --packed the screens are stored packed for the PACKED_MAZES build
+# (tools/packmaze.py) in stead of as sp1 print strings.
+
+from argparse import ArgumentParser
+import re
+import struct
+import sys
+
+__version__ = "1.0"
+
+BANK_ORG = 0xc000
+BANK_SIZE = 16384
+SCREEN_MAX = 512            # MAZE_PTILES_SIZE in src/main.c
+TILES_SIZE = 16 * 8         # TILES_LEN udgs
+
+
+def read_labels(name):
+    # bytes of every label in a png2c.py source: "_name:" followed by defb lines
+    labels = {}
+    label = None
+    with open(name, "r") as fd:
+        for line in fd:
+            line = line.split(";")[0].strip()
+            m = re.match(r"^_(\w+):$", line)
+            if m:
+                label = m.group(1)
+                labels[label] = bytearray()
+            elif line.startswith("defb") and label:
+                labels[label] += bytearray(int(v, 0) for v in line[4:].split(","))
+    return labels
+
+
+def main():
+
+    parser = ArgumentParser(description="Make the maze bank of the 128K build")
+
+    parser.add_argument("--version", action="version", version="%(prog)s "  + __version__)
+    parser.add_argument("--packed", dest="packed", action="store_true",
+                        help="packed screens for the PACKED_MAZES build")
+    parser.add_argument("file", help="binary to write (org 0x%04x)" % BANK_ORG)
+    parser.add_argument("mazes", nargs="+", help="png2c.py sources, one per maze (gfx/tiles.asm ...)")
+
+    args = parser.parse_args()
+
+    screens = []
+    tiles = []
+    for name in args.mazes:
+        labels = read_labels(name)
+        screen = [v for k, v in labels.items() if k.startswith("ptiles")]
+        tile = [v for k, v in labels.items() if k.startswith("tiles")]
+        if len(screen) != 1 or len(tile) != 1:
+            sys.exit("ERROR: %s needs one _ptiles* and one _tiles* label" % name)
+        if len(screen[0]) > SCREEN_MAX:
+            sys.exit("ERROR: screen of %s is %d bytes, more than %d" % (name, len(screen[0]), SCREEN_MAX))
+        if len(tile[0]) != TILES_SIZE:
+            sys.exit("ERROR: tiles of %s are %d bytes, not %d" % (name, len(tile[0]), TILES_SIZE))
+        if args.packed:
+            from packmaze import pack
+            screen[0] = pack(name)[0]
+        screens.append(screen[0])
+        tiles.append(tile[0])
+
+    directory = bytearray()
+    data = bytearray()
+    addr = BANK_ORG + 6 * len(args.mazes)
+    for screen, tile in zip(screens, tiles):
+        directory += struct.pack("<HHH", addr + len(data), len(screen), addr + len(data) + len(screen))
+        data += screen + tile
+
+    bank = directory + data
+    if len(bank) > BANK_SIZE:
+        sys.exit("ERROR: %d bytes, a bank has %d" % (len(bank), BANK_SIZE))
+
+    with open(args.file, "wb") as fd:
+        fd.write(bank)
+
+    print("%d mazes, %d bytes (%d free in the bank)" % (len(args.mazes), len(bank), BANK_SIZE - len(bank)))
+
+if __name__ == "__main__":
+    main()
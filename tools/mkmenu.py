@@ -0,0 +1,49 @@
+#!/usr/bin/env python
+
+# Menu logo for the MENU_SCREEN build: the top third of the display file
+# (0x4000, 2048 bytes) with the logo of draw_menu() in src/main.c, to be
+# compressed with z88dk-zx7 and unpacked by dzx7_standard() straight to the
+# screen (see build.sh and gfx/menu.asm).
+#
+# Only the logo is pre-rendered, the texts below it use the ROM font and
+# are still printed by sp1. The logo colour is set by draw_menu().
+
+from argparse import ArgumentParser
+
+__version__ = "1.0"
+
+THIRD = 2048                # bytes of a third of the display file
+BLOCK = 0xff                # the rows of udg_square_block (gfx/udg.asm)
+
+# the logo in draw_menu(), ':' is a block
+LOGO = ("::::: : : ::: ::: : : :  : : :::",
+        ": : : : : : : :   : : : :  : : :",
+        ": : : : : : : :   ::: ::   : : :",
+        ": : : : : : : :   : : : :  : : :",
+        ": : : ::: : : ::: : : :  : : : :")
+
+
+def main():
+
+    parser = ArgumentParser(description="Make the top third of the menu screen for the MENU_SCREEN build")
+
+    parser.add_argument("--version", action="version", version="%(prog)s "  + __version__)
+    parser.add_argument("file", help="binary to write (menu.bin)")
+
+    args = parser.parse_args()
+
+    third = bytearray(THIRD)
+    for row, line in enumerate(LOGO):
+        for col, c in enumerate(line):
+            if c == ":":
+                for pixel_row in range(8):
+                    # display file: pixel row * 256 + char row * 32 + column
+                    third[pixel_row * 256 + row * 32 + col] = BLOCK
+
+    with open(args.file, "wb") as fd:
+        fd.write(third)
+
+    print("%s: %d bytes, %d logo rows" % (args.file, len(third), len(LOGO)))
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,36 @@
+#!/usr/bin/env python
+
+# Prebuilt sp1 horizontal rotation tables (what sp1_Initialize makes with
+# SP1_IFLAG_MAKE_ROTTBL), to load from tape at ROTTBL_ORG.
+#
+# For every rotation r = 1..7 there are two 256 byte pages:
+#   page 2r    : byte >> r              (part that stays in the char)
+#   page 2r + 1: (byte << (8 - r)) & 255 (part that moves to the next char)
+# Rotation 0 is never looked up, its two pages hold the sp1 tile array.
+
+from argparse import ArgumentParser
+
+__version__ = "1.0"
+
+ROTTBL_ORG = 0xf200         # SP1V_ROTTBL (0xf000) + 2 pages
+
+
+def main():
+
+    parser = ArgumentParser(description="Make the sp1 rotation tables as a binary")
+
+    parser.add_argument("--version", action="version", version="%(prog)s "  + __version__)
+    parser.add_argument("file", help="binary to write (%d bytes, org 0x%04x)" % (7 * 512, ROTTBL_ORG))
+
+    args = parser.parse_args()
+
+    data = bytearray()
+    for r in range(1, 8):
+        data += bytearray(b >> r for b in range(256))
+        data += bytearray((b << (8 - r)) & 255 for b in range(256))
+
+    with open(args.file, "wb") as fd:
+        fd.write(data)
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,108 @@
+#!/usr/bin/env python
+
+# Packed maze screens for the PACKED_MAZES build: the sp1 print string of
+# every maze (the _ptiles* label of the png2c.py output in gfx/) as a run
+# length coded list of the 32 x 24 tiles, unpacked by unpack_maze() in
+# src/main.c straight into the sp1 update structs.
+#
+# Format, tile by tile from the top left corner, row after row:
+#   tile (TILES_BASE or more)   one tile
+#   n (1 to TILES_BASE - 1)     the next byte repeated n times
+#   0                           end
+# The colour is not stored, print_maze() gives the whole maze one colour.
+#
+# Without a file it only reports the sizes.
+
+from argparse import ArgumentParser
+import sys
+
+from mkbank import read_labels
+
+__version__ = "1.0"
+
+WIDTH = 32
+HEIGHT = 24
+TILES_BASE = 128            # first tile of the mazes, lower bytes are run lengths
+
+
+def decode(name, pstring):
+    # the tiles of an sp1 print string as printed from (0, 0), one list per row
+    rows = [[]]
+    p = 0
+    repeat = None
+    while pstring[p] != 0x00:
+        c = pstring[p]
+        if c == 0x14:                       # colour
+            p += 1
+        elif c == 0x0d:                     # next row
+            rows.append([])
+        elif c == 0x0e:                     # repeat n times up to 0x0f
+            repeat = (pstring[p + 1], p + 2)
+            p += 1
+        elif c == 0x0f:
+            n, start = repeat
+            if n > 1:
+                repeat = (n - 1, start)
+                p = start
+                continue
+        elif c >= TILES_BASE:
+            rows[-1].append(c)
+        else:
+            sys.exit("ERROR: %s: print code 0x%02x not supported" % (name, c))
+        p += 1
+    rows = [row for row in rows if row]
+    if len(rows) != HEIGHT or any(len(row) != WIDTH for row in rows):
+        sys.exit("ERROR: %s: the maze is not %d x %d tiles" % (name, WIDTH, HEIGHT))
+    return sum(rows, [])
+
+
+def encode(tiles):
+    packed = bytearray()
+    p = 0
+    while p < len(tiles):
+        n = 1
+        while p + n < len(tiles) and tiles[p + n] == tiles[p] and n < TILES_BASE - 1:
+            n += 1
+        if n > 2:
+            packed += bytearray((n, tiles[p]))
+        else:
+            packed += bytearray(tiles[p:p + n])
+        p += n
+    return packed + bytearray((0,))
+
+
+def pack(name):
+    # the packed screen of a png2c.py source and the size of its print string
+    labels = read_labels(name)
+    screen = [v for k, v in labels.items() if k.startswith("ptiles")]
+    if len(screen) != 1:
+        sys.exit("ERROR: %s needs one _ptiles* label" % name)
+    return encode(decode(name, screen[0])), len(screen[0])
+
+
+def main():
+
+    parser = ArgumentParser(description="Run length pack the maze screens for the PACKED_MAZES build")
+
+    parser.add_argument("--version", action="version", version="%(prog)s "  + __version__)
+    parser.add_argument("-o", "--output", dest="file", help="source to write (gfx/mazes_packed.asm)")
+    parser.add_argument("mazes", nargs="+", help="png2c.py sources, one per maze (gfx/tiles.asm ...)")
+
+    args = parser.parse_args()
+
+    out = ""
+    for name in args.mazes:
+        packed, size = pack(name)
+        label = [k for k in read_labels(name) if k.startswith("ptiles")][0] + "_packed"
+        print("%s: %d -> %d bytes" % (name, size, len(packed)))
+        out += "\nPUBLIC _%s\n\n._%s\n" % (label, label)
+        for part in range(0, len(packed), 8):
+            out += "\tdefb " + ", ".join("0x%02x" % b for b in packed[part:part + 8]) + "\n"
+
+    if args.file:
+        with open(args.file, "w") as fd:
+            fd.write("; PACKED_MAZES\n; made by tools/packmaze.py from %s, do not edit\n\n" % " ".join(args.mazes))
+            fd.write("IFDEF PACKED_MAZES\n\nSECTION rodata_user\n%s\nENDIF\n" % out)
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,78 @@
+#!/usr/bin/env python
+
+# Pre-shifted sprite frames: the 8 horizontal shifts (x & 7) of the given
+# frames of a gfx/*.asm sprite source, so sp1 can draw them with the
+# SP1_DRAW_MASK2NR functions (no rotation tables) in the PRESHIFT_* builds
+# (see build.sh and PRESHIFT_STRIDE in src/main.c).
+#
+# Per frame and shift: the left column (8 rows), 8 blank rows, the right
+# column (8 rows), 8 blank rows, so 64 bytes per shift and 512 per frame.
+# The output is wrapped in IFDEF <define> and is empty in the normal build.
+
+from argparse import ArgumentParser
+import sys
+
+from spritepack import read_sprites, BLANK, BEFORE
+
+__version__ = "1.0"
+
+SHIFTS = 8
+COLUMN = 32                 # bytes from the left column to the right column (PRESHIFT_COLUMN)
+STRIDE = 64                 # bytes per shift (PRESHIFT_STRIDE)
+
+
+def shift_rows(rows, shift):
+    # left and right column of a frame moved shift pixels to the right,
+    # the mask is filled with 1s (transparent)
+    left = []
+    right = []
+    for m, g in rows:
+        m = ((m << 8 | 0xff) >> shift) | (0xffff << (16 - shift) & 0xffff)
+        g = (g << 8) >> shift
+        left.append(((m >> 8) & 0xff, (g >> 8) & 0xff))
+        right.append((m & 0xff, g & 0xff))
+    return left, right
+
+
+def main():
+
+    parser = ArgumentParser(description="Make the 8 pre-shifted copies of sprite frames")
+
+    parser.add_argument("--version", action="version", version="%(prog)s "  + __version__)
+    parser.add_argument("define", help="build flag the output is assembled with (PRESHIFT_MUNCHKIN ...)")
+    parser.add_argument("file", help="source to write (gfx/munchkin_shifted.asm ...)")
+    parser.add_argument("source", help="sprite source (gfx/munchkin.asm ...)")
+    parser.add_argument("frames", nargs="+", help="frames to pre-shift (munchkin munchkin_left ...)")
+
+    args = parser.parse_args()
+
+    header, frames, rows = read_sprites(args.source)
+    frames = dict(frames)
+    for name in args.frames:
+        if name not in frames:
+            sys.exit("ERROR: no frame %s in %s" % (name, args.source))
+
+    blank = "\tdefb @{:08b}, @{:08b}\n".format(*BLANK)
+
+    with open(args.file, "w") as fd:
+        fd.write("; %s\n; made by tools/preshift.py from %s, do not edit\n\n" % (args.define, args.source))
+        fd.write("IFDEF %s\n\nSECTION rodata_user\n\n" % args.define)
+        for name in args.frames:
+            fd.write("PUBLIC _%s_shifted\n" % name)
+        fd.write("\n" + blank * BEFORE)
+        for name in args.frames:
+            fd.write("\n._%s_shifted\n" % name)
+            for shift in range(SHIFTS):
+                left, right = shift_rows(frames[name], shift)
+                for column in (left, right):
+                    if column is right or shift:
+                        fd.write("\n")
+                    for m, g in column:
+                        fd.write("\tdefb @{:08b}, @{:08b}\n".format(m, g))
+                    fd.write("\n" + blank * ((COLUMN // 2) - 8))
+        fd.write("\nENDIF\n")
+
+    print("%s: %d frames, %d bytes" % (args.file, len(args.frames), BEFORE * 2 + len(args.frames) * SHIFTS * STRIDE))
+
+if __name__ == "__main__":
+    main()
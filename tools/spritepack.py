@@ -0,0 +1,197 @@
+#!/usr/bin/env python
+
+# Pack the sprite frames of gfx/*.asm (sp1 masked 2 byte sprites, one char
+# wide: "._name" followed by 8 rows of "defb @mask, @graphic").
+#
+# sp1 draws a frame of a sprite with a blank char below it (height 2) and
+# reads up to 7 rows before the frame for the vertical rotation, so every
+# frame needs 7 blank rows before and 8 after. The rows are stored once:
+# - identical frames share their rows (two labels on the same address)
+# - the blank rows after a frame overlap the blank rows before the next one
+#   and its leading blank rows
+# Mirrored and flipped frames are reported only, sp1 can't draw them mirrored.
+#
+# Without --write it only reports, with --write the rows that go are taken out
+# of the files (and rows that are needed added), the other lines stay as they are.
+
+from argparse import ArgumentParser
+from difflib import SequenceMatcher
+import re
+import sys
+
+__version__ = "1.0"
+
+BLANK = (0xff, 0x00)        # mask, graphic
+BEFORE = 7                  # blank rows needed before a frame
+AFTER = 8                   # blank rows needed after a frame (the blank char)
+
+
+def read_sprites(name):
+    header = []
+    frames = []             # [name, [rows]]
+    current = []            # frames getting the next rows (more labels on one frame: all of them)
+    rows = 0
+    with open(name, "r") as fd:
+        for line in fd:
+            code = line.split(";")[0].strip()
+            m = re.match(r"^\._(\w+)$", code)
+            if m:
+                frames.append([m.group(1), []])
+                if not current or current[-1][1]:
+                    current = []
+                current.append(frames[-1])
+            elif code.startswith("defb"):
+                rows += 1
+                for frame in current:
+                    if len(frame[1]) < 8:
+                        frame[1].append(tuple(int(v.strip().lstrip("@"), 2) for v in code[4:].split(",")))
+            elif not frames and rows == 0:
+                header.append(line.rstrip())
+    for frame in frames:
+        if len(frame[1]) != 8:
+            sys.exit("ERROR: %s: frame %s has %d rows, not 8" % (name, frame[0], len(frame[1])))
+    return header, frames, rows
+
+
+def mirror(rows):
+    rev = lambda b: int("{:08b}".format(b)[::-1], 2)
+    return [(rev(m), rev(g)) for m, g in rows]
+
+
+def leading(rows):
+    n = 0
+    while n < len(rows) and rows[n] == BLANK:
+        n += 1
+    return n
+
+
+def trailing(rows):
+    return leading(rows[::-1])
+
+
+def pack(frames):
+    # place the frames in their order, as early as the blank rows allow
+    # returns the row of every frame name and the total number of rows
+    place = {}
+    unique = []
+    for name, rows in frames:
+        same = [n for n, r in unique if r == rows]
+        if same:
+            place[name] = place[same[0]]
+            continue
+        if not unique:
+            start = BEFORE
+        else:
+            last_name, last = unique[-1]
+            end = place[last_name] + 8 - trailing(last)    # first blank row after the last frame
+            start = max(end + BEFORE, place[last_name] + 8 + AFTER - leading(rows))
+        place[name] = start
+        unique.append((name, rows))
+    last_name = unique[-1][0]
+    return place, place[last_name] + 8 + AFTER
+
+
+def read_items(name):
+    # the lines of a sprite source as labels and rows, every one with its own
+    # text and the blank or comment lines before it
+    items = []              # [key, lines]
+    before = []
+    with open(name, "r") as fd:
+        for line in fd:
+            code = line.split(";")[0].strip()
+            m = re.match(r"^\._(\w+)$", code)
+            if m:
+                items.append([("label", m.group(1)), before + [line]])
+                before = []
+            elif code.startswith("defb"):
+                rows = tuple(int(v.strip().lstrip("@"), 2) for v in code[4:].split(","))
+                items.append([("row", rows), before + [line]])
+                before = []
+            else:
+                before.append(line)
+    return items, before
+
+
+def write_sprites(name, frames, place, total):
+    # rewrite the file with as few changes as possible: the lines of the rows
+    # and labels that stay are kept as they are, only the rows that go are
+    # dropped and new ones added
+    stream = [BLANK] * total
+    labels = {}
+    for frame_name, rows in frames:
+        stream[place[frame_name]:place[frame_name] + 8] = rows
+        labels.setdefault(place[frame_name], []).append(frame_name)
+
+    new = []
+    for row, rows in enumerate(stream):
+        for label in labels.get(row, []):
+            new.append(("label", label))
+        new.append(("row", rows))
+
+    items, tail = read_items(name)
+    old = [key for key, lines in items]
+
+    out = []
+    gap = False             # a dropped row had a blank line before it, the next line gets it
+    matcher = SequenceMatcher(None, old, new, autojunk=False)
+    for op, i1, i2, j1, j2 in matcher.get_opcodes():
+        if op != "equal":
+            # comment lines before dropped rows stay
+            for key, lines in items[i1:i2]:
+                out += [line for line in lines[:-1] if line.strip()]
+                gap = gap or any(not line.strip() for line in lines[:-1])
+        if op != "delete" and gap:
+            first = items[i1][1][0] if op == "equal" else "\n"
+            if first.strip() and out and out[-1].strip():
+                out.append("\n")
+            gap = False
+        if op == "equal":
+            for key, lines in items[i1:i2]:
+                out += lines
+        else:
+            for kind, value in new[j1:j2]:
+                if kind == "label":
+                    out.append("._%s\n" % value)
+                else:
+                    out.append("\tdefb @{:08b}, @{:08b}\n".format(*value))
+
+    with open(name, "w") as fd:
+        fd.writelines(out + tail)
+
+
+def main():
+
+    parser = ArgumentParser(description="Share and overlap the sprite frames of sp1 sprite sources")
+
+    parser.add_argument("--version", action="version", version="%(prog)s "  + __version__)
+    parser.add_argument("--write", dest="write", action="store_true",
+                        help="rewrite the files (default: report only)")
+    parser.add_argument("files", nargs="+", help="sprite sources (gfx/munchkin.asm ...)")
+
+    args = parser.parse_args()
+
+    total_before = total_after = 0
+    for name in args.files:
+        header, frames, rows = read_sprites(name)
+
+        for i, (a, rows_a) in enumerate(frames):
+            for b, rows_b in frames[i + 1:]:
+                if rows_a == rows_b:
+                    print("%s: %s is the same as %s, shared" % (name, b, a))
+                elif mirror(rows_a) == rows_b:
+                    print("%s: %s is %s mirrored (stored twice)" % (name, b, a))
+                elif rows_a[::-1] == rows_b:
+                    print("%s: %s is %s upside down (stored twice)" % (name, b, a))
+
+        place, after = pack(frames)
+        print("%s: %d frames, %d -> %d bytes" % (name, len(frames), rows * 2, after * 2))
+        total_before += rows * 2
+        total_after += after * 2
+
+        if args.write:
+            write_sprites(name, frames, place, after)
+
+    print("saved %d bytes" % (total_before - total_after))
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,114 @@
+#!/usr/bin/env python
+
+# Check the assembly movement kernels (src/move.asm, the ASM_MOVEMENT build)
+# against the C versions in src/main.c. The C versions run in a host build
+# (tools/hostbuild.py, tools/host/move_trace.c) that writes randomized
+# traces of move_munchkin() and move_actor() in every maze and center
+# rotation. The assembly runs through the same steps in a Z80 model
+# (tools/z80model.py) with its own state. After every step the model must
+# have the same x, y, auto and last direction (munchkin) or x, y and
+# countdown (ghosts and pills) as the C version.
+#
+# The memory layout comes from the GAME_* and ACTOR_* offsets in move.asm,
+# main.c checks that they match game_state_type and actor_type.
+#
+# Exits with 1 when a trace differs.
+
+from argparse import ArgumentParser
+import os
+import subprocess
+import sys
+import tempfile
+
+from hostbuild import ROOT, build
+from z80model import Z80
+
+__version__ = "1.0"
+
+GAME = 0x8000               # address of game in the model
+ACTOR = 0xa000              # address of the actor_type
+MAX_REPORTS = 10
+
+
+def main():
+
+    parser = ArgumentParser(description="Check src/move.asm against the C movement kernels")
+
+    parser.add_argument("--version", action="version", version="%(prog)s "  + __version__)
+    parser.add_argument("--seed", type=int, default=1, help="seed of the traces (default 1)")
+    parser.add_argument("--traces", type=int, default=100,
+                        help="munchkin traces per maze and center rotation, 8 times as many actor traces (default 100)")
+    parser.add_argument("--steps", type=int, default=100, help="steps per trace (default 100)")
+
+    args = parser.parse_args()
+
+    with open(os.path.join(ROOT, "src", "move.asm"), "r") as fd:
+        cpu = Z80(fd.read(), set(["ASM_MOVEMENT"]), {"_game": GAME})
+    sym = cpu.symbols
+    mem = cpu.mem
+
+    fd, program = tempfile.mkstemp()
+    os.close(fd)
+    try:
+        build("move_trace.c", [], program)
+        traces = subprocess.check_output([program, str(args.seed), str(args.traces), str(args.steps)])
+    finally:
+        os.remove(program)
+
+    steps = bad = 0
+    longest = {}
+    trace = None
+    failed = False          # this trace differed already, skip the rest of it
+    for line in traces.decode().splitlines():
+        word = line.split()
+        kind, v = word[0], [int(x) for x in word[1:]]
+
+        if kind == "V":
+            mem[GAME + sym["GAME_VERTICAL_LINES"]:GAME + sym["GAME_VERTICAL_LINES"] + len(v)] = bytearray(v)
+        elif kind == "H":
+            mem[GAME + sym["GAME_HORIZONTAL_LINES"]:GAME + sym["GAME_HORIZONTAL_LINES"] + len(v)] = bytearray(v)
+
+        elif kind == "M":
+            trace, failed = line, False
+            for name, x in zip(("GAME_MUNCHKIN_X", "GAME_MUNCHKIN_Y", "GAME_SPEED", "GAME_AUTO_DIRECTION", "GAME_LAST_DIRECTION"), v):
+                mem[GAME + sym[name]] = x
+        elif kind == "m" and not failed:
+            steps += 1
+            cpu.reg["l"] = v[0]
+            n = cpu.call("_move_munchkin")
+            longest["move_munchkin"] = max(longest.get("move_munchkin", 0), n)
+            got = [mem[GAME + sym[name]] for name in ("GAME_MUNCHKIN_X", "GAME_MUNCHKIN_Y", "GAME_AUTO_DIRECTION", "GAME_LAST_DIRECTION")]
+            if got != v[1:]:
+                bad += 1
+                failed = True
+                if bad <= MAX_REPORTS:
+                    print("move_munchkin differs: trace %s, step key %d: C x y auto last %s, asm %s" % (trace, v[0], v[1:], got))
+
+        elif kind == "A":
+            trace, failed = line, False
+            x, y, direction, speed, countdown = v
+            mem[ACTOR + sym["ACTOR_X"]] = x
+            mem[ACTOR + sym["ACTOR_X"] + 1] = y
+            mem[ACTOR + sym["ACTOR_DIRECTION"]] = direction
+            mem[ACTOR + sym["ACTOR_DIRECTION"] + 1] = speed
+            mem[ACTOR + sym["ACTOR_DIRECTION"] + 2] = countdown
+        elif kind == "a" and not failed:
+            steps += 1
+            mem[ACTOR + sym["ACTOR_DIRECTION"]] = v[0]
+            mem[ACTOR + sym["ACTOR_DIRECTION"] + 2] = v[1]
+            cpu.set_pair("hl", ACTOR)
+            n = cpu.call("_move_actor")
+            longest["move_actor"] = max(longest.get("move_actor", 0), n)
+            got = [mem[ACTOR + sym["ACTOR_X"]], mem[ACTOR + sym["ACTOR_X"] + 1], mem[ACTOR + sym["ACTOR_DIRECTION"] + 2]]
+            if got != v[2:]:
+                bad += 1
+                failed = True
+                if bad <= MAX_REPORTS:
+                    print("move_actor differs: trace %s, step direction %d countdown %d: C x y countdown %s, asm %s" % (trace, v[0], v[1], v[2:], got))
+
+    print("%d steps, %d traces differ, most instructions per call: %s" % (steps, bad,
+          ", ".join("%s %d" % (k, longest[k]) for k in sorted(longest))))
+    sys.exit(1 if bad else 0)
+
+if __name__ == "__main__":
+    main()
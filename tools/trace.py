@@ -0,0 +1,60 @@
+#!/usr/bin/env python
+
+# Trace whole games of src/main.c on the host (tools/hostbuild.py,
+# tools/host/game_trace.c): the real run_play() with a seeded random player
+# on the joystick, one line per step with the munchkin, ghosts, pills, sp1
+# work, colours, screen and the sprite moves, sounds and prints of the step.
+# The same seed, steps and build options give the same game, so a change to
+# main.c that should not change the game is checked with diff:
+#
+#   python tools/trace.py --steps 5000 > before.txt
+#   (change main.c)
+#   python tools/trace.py --steps 5000 > after.txt
+#   diff before.txt after.txt
+#
+# At the end the update structs invalidated and sprites moved per step are
+# written to stderr (the host has no frame times, only this count of work).
+
+from argparse import ArgumentParser
+import os
+import subprocess
+import sys
+import tempfile
+
+from hostbuild import build
+
+__version__ = "1.0"
+
+
+def main():
+
+    parser = ArgumentParser(description="Trace games of src/main.c built for the host")
+
+    parser.add_argument("--version", action="version", version="%(prog)s "  + __version__)
+    parser.add_argument("-D", dest="defines", action="append", default=[], metavar="NAME[=VALUE]",
+                        help="build option, as on the zcc line (WFRAMES=1 unless given)")
+    parser.add_argument("--seed", type=int, default=1, help="seed of the game and the player (default 1)")
+    parser.add_argument("--steps", type=int, default=2000, help="steps to play (default 2000)")
+    parser.add_argument("--ghosts", type=int, help="number of ghosts (default NUM_GHOSTS, 0 to finish mazes)")
+
+    args = parser.parse_args()
+
+    defines = args.defines
+    if not any(d.split("=")[0] == "WFRAMES" for d in defines):
+        defines = ["WFRAMES=1"] + defines
+
+    fd, program = tempfile.mkstemp()
+    os.close(fd)
+    try:
+        build("game_trace.c", defines, program)
+        command = [program, str(args.seed), str(args.steps)]
+        if args.ghosts is not None:
+            command.append(str(args.ghosts))
+        sys.stdout.flush()
+        status = subprocess.call(command)
+    finally:
+        os.remove(program)
+    sys.exit(status)
+
+if __name__ == "__main__":
+    main()
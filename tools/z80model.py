@@ -0,0 +1,173 @@
+#!/usr/bin/env python
+
+# A small Z80 model for the host checks (tools/test_move.py): it runs the
+# z80asm source of routines like src/move.asm instruction by instruction,
+# with 64K of memory and the registers.
+#
+# Only the instructions and flags move.asm uses are there (S, Z and C; no
+# H, P/V or N). Anything else stops it with an error, so a new instruction
+# in move.asm shows up here first.
+
+import re
+
+__version__ = "1.0"
+
+REGS = ("a", "b", "c", "d", "e", "h", "l")
+PAIRS = ("bc", "de", "hl")
+
+
+class Z80(object):
+
+    def __init__(self, source, defines, symbols):
+        # source: z80asm text, defines: names for IFDEF, symbols: {name: address} of the EXTERNs
+        self.program = []           # (instruction, [operands])
+        self.labels = {}
+        self.symbols = dict(symbols)
+        skip = []
+        for line in source.splitlines():
+            code = line.split(";")[0].strip()
+            if not code:
+                continue
+            word = code.split(None, 1)
+            if word[0] in ("IFDEF", "IFNDEF"):
+                skip.append((word[1].strip() in defines) != (word[0] == "IFDEF"))
+                continue
+            if word[0] == "ENDIF":
+                skip.pop()
+                continue
+            if any(skip) or word[0] in ("SECTION", "PUBLIC", "EXTERN"):
+                continue
+            if word[0] == "defc":
+                name, expression = word[1].split("=")
+                self.symbols[name.strip()] = self.value(expression)
+                continue
+            if code.endswith(":"):
+                self.labels[code[:-1]] = len(self.program)
+                continue
+            operands = [o.strip() for o in word[1].split(",")] if len(word) > 1 else []
+            self.program.append((word[0], operands))
+        self.reg = dict.fromkeys(REGS, 0)
+        self.mem = bytearray(65536)
+        self.s = self.z = self.c = 0
+
+    def value(self, expression):
+        # number, symbol or a + b / a - b of those
+        expression = expression.strip()
+        m = re.match(r"^(\w+)\s*([-+])\s*(\w+)$", expression)
+        if m:
+            a, b = self.value(m.group(1)), self.value(m.group(3))
+            return a + b if m.group(2) == "+" else a - b
+        if re.match(r"^'.'$", expression):
+            return ord(expression[1])
+        if expression.startswith("$"):
+            return int(expression[1:], 16)
+        if re.match(r"^(0x[0-9a-fA-F]+|\d+)$", expression):
+            return int(expression, 0)
+        return self.symbols[expression]
+
+    def pair(self, name):
+        return self.reg[name[0]] << 8 | self.reg[name[1]]
+
+    def set_pair(self, name, v):
+        self.reg[name[0]] = (v >> 8) & 0xff
+        self.reg[name[1]] = v & 0xff
+
+    def get8(self, operand):
+        if operand in REGS:
+            return self.reg[operand]
+        if operand in ("(hl)", "(de)", "(bc)"):
+            return self.mem[self.pair(operand[1:3])]
+        if operand.startswith("("):
+            return self.mem[self.value(operand[1:-1]) & 0xffff]
+        return self.value(operand) & 0xff
+
+    def put8(self, operand, v):
+        v &= 0xff
+        if operand in REGS:
+            self.reg[operand] = v
+        elif operand in ("(hl)", "(de)", "(bc)"):
+            self.mem[self.pair(operand[1:3])] = v
+        else:
+            self.mem[self.value(operand[1:-1]) & 0xffff] = v
+
+    def flags(self, v, carry):
+        # S, Z and C of an 8 bit result
+        v &= 0xff
+        self.s = v >> 7
+        self.z = int(v == 0)
+        self.c = carry
+        return v
+
+    def condition(self, name):
+        return {"z": self.z, "nz": not self.z, "c": self.c, "nc": not self.c,
+                "m": self.s, "p": not self.s}[name]
+
+    def call(self, label, limit=10000):
+        # run the routine at label up to its ret, returns the number of instructions
+        stack = [None]
+        pc = self.labels[label]
+        count = 0
+        while pc is not None:
+            count += 1
+            if count > limit:
+                raise RuntimeError("%s: no ret after %d instructions" % (label, limit))
+            op, args = self.program[pc]
+            pc += 1
+            if op == "ld":
+                if args[0] in PAIRS:
+                    self.set_pair(args[0], self.value(args[1]) & 0xffff)
+                else:
+                    self.put8(args[0], self.get8(args[1]))
+            elif op in ("inc", "dec"):
+                step = 1 if op == "inc" else -1
+                if args[0] in PAIRS:
+                    self.set_pair(args[0], (self.pair(args[0]) + step) & 0xffff)
+                else:
+                    v = (self.get8(args[0]) + step) & 0xff
+                    self.put8(args[0], v)
+                    self.s = v >> 7
+                    self.z = int(v == 0)
+            elif op == "add" and args[0] == "hl":
+                v = self.pair("hl") + self.pair(args[1])
+                self.c = v >> 16
+                self.set_pair("hl", v & 0xffff)
+            elif op == "sbc" and args[0] == "hl":
+                v = self.pair("hl") - self.pair(args[1]) - self.c
+                self.c = int(v < 0)
+                v &= 0xffff
+                self.set_pair("hl", v)
+                self.s = v >> 15
+                self.z = int(v == 0)
+            elif op == "add":
+                v = self.reg["a"] + self.get8(args[1])
+                self.reg["a"] = self.flags(v, v >> 8)
+            elif op in ("sub", "cp"):
+                v = self.reg["a"] - self.get8(args[-1])
+                r = self.flags(v, int(v < 0))
+                if op == "sub":
+                    self.reg["a"] = r
+            elif op in ("and", "or", "xor"):
+                a, b = self.reg["a"], self.get8(args[0])
+                self.reg["a"] = self.flags(a & b if op == "and" else a | b if op == "or" else a ^ b, 0)
+            elif op == "rrca":
+                a = self.reg["a"]
+                self.c = a & 1
+                self.reg["a"] = (a >> 1 | a << 7) & 0xff
+            elif op == "bit":
+                self.z = int(not (self.get8(args[1]) >> int(args[0]) & 1))
+            elif op == "ex" and args == ["de", "hl"]:
+                hl, de = self.pair("hl"), self.pair("de")
+                self.set_pair("hl", de)
+                self.set_pair("de", hl)
+            elif op in ("jr", "jp"):
+                if len(args) == 1 or self.condition(args[0]):
+                    pc = self.labels[args[-1]]
+            elif op == "call":
+                stack.append(pc)
+                pc = self.labels[args[0]]
+            elif op == "ret":
+                if not args or self.condition(args[0]):
+                    pc = stack.pop()
+            else:
+                raise RuntimeError("%s %s: not in the model" % (op, ",".join(args)))
+        return count